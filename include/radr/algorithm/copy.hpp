@@ -0,0 +1,60 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Copyright (c) 2023-2025 Hannes Hauswedell
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See the LICENSE file for details.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include <algorithm>
+#include <iterator>
+#include <ranges>
+#include <utility>
+
+#include "../concepts.hpp"
+#include "../custom/for_each_segment.hpp"
+#include "../custom/tags.hpp"
+#include "../range_access.hpp"
+
+namespace radr
+{
+
+/*!\brief Copies the elements of \p range to \p out.
+ * \param range The range.
+ * \param out The output iterator.
+ * \returns \p out advanced by the number of elements.
+ * \details
+ *
+ * Like std::ranges::copy, but multi-pass ranges are iterated via radr::for_each_segment (see radr::for_each).
+ * Every segment is copied via std::ranges::copy, so contiguous segments of trivially copyable elements are copied
+ * via memmove.
+ *
+ * Segments whose iterators customise `tag_invoke(custom::copy_tag, it, sen, out)` are copied via the customisation
+ * instead. radr::filter uses this to evaluate the predicate without branches on contiguous ranges of arithmetic values.
+ */
+template <std::ranges::input_range Range, std::weakly_incrementable Out>
+    requires std::indirectly_copyable<std::ranges::iterator_t<Range>, Out>
+constexpr Out copy(Range && range, Out out)
+{
+    auto loop = [&out](auto && rng)
+    {
+        if constexpr (requires { tag_invoke(custom::copy_tag{}, radr::begin(rng), radr::end(rng), std::move(out)); })
+            out = tag_invoke(custom::copy_tag{}, radr::begin(rng), radr::end(rng), std::move(out));
+        else
+            out = std::ranges::copy(rng, std::move(out)).out;
+    };
+
+    if constexpr (borrowed_mp_range<Range &>)
+        radr::for_each_segment(range, loop);
+    else
+        loop(range);
+
+    return out;
+}
+
+} // namespace radr
@@ -0,0 +1,73 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Copyright (c) 2023-2025 Hannes Hauswedell
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See the LICENSE file for details.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include <functional>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+
+#include "../concepts.hpp"
+#include "../custom/for_each_segment.hpp"
+
+namespace radr::detail
+{
+
+//!\brief The accumulator type of radr::fold.
+template <typename Op, typename T, typename Ref>
+using fold_acc_t = std::decay_t<std::invoke_result_t<Op &, T, Ref>>;
+
+//!\brief The requirements of radr::fold (a simplified version of C++23's indirectly-binary-left-foldable).
+template <typename Op, typename T, typename Ref>
+concept foldable = std::move_constructible<T> && std::invocable<Op &, T, Ref> &&
+                   std::constructible_from<fold_acc_t<Op, T, Ref>, T> &&
+                   std::invocable<Op &, fold_acc_t<Op, T, Ref>, Ref> &&
+                   std::assignable_from<fold_acc_t<Op, T, Ref> &,
+                                        std::invoke_result_t<Op &, fold_acc_t<Op, T, Ref>, Ref>>;
+
+} // namespace radr::detail
+
+namespace radr
+{
+
+/*!\brief Combines \p init and the elements of \p range left-to-right via \p op.
+ * \param range The range.
+ * \param init The initial value.
+ * \param op The binary operation.
+ * \returns `op(...op(op(init, e0), e1)..., eN)` as `std::decay_t<std::invoke_result_t<Op &, T, reference>>`.
+ * \details
+ *
+ * Like std::ranges::fold_left (C++23), but multi-pass ranges are iterated via radr::for_each_segment (see
+ * radr::for_each).
+ */
+template <std::ranges::input_range Range, typename T, typename Op>
+    requires detail::foldable<Op, T, std::ranges::range_reference_t<Range>>
+constexpr auto fold(Range && range, T init, Op op)
+{
+    using acc_t = detail::fold_acc_t<Op, T, std::ranges::range_reference_t<Range>>;
+
+    acc_t acc(std::move(init));
+    auto  loop = [&acc, &op](auto && rng)
+    {
+        for (auto && elem : rng)
+            acc = std::invoke(op, std::move(acc), std::forward<decltype(elem)>(elem));
+    };
+
+    if constexpr (borrowed_mp_range<Range &>)
+        radr::for_each_segment(range, loop);
+    else
+        loop(range);
+
+    return acc;
+}
+
+} // namespace radr
@@ -0,0 +1,52 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Copyright (c) 2023-2025 Hannes Hauswedell
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See the LICENSE file for details.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include <functional>
+#include <ranges>
+#include <utility>
+
+#include "../concepts.hpp"
+#include "../custom/for_each_segment.hpp"
+
+namespace radr
+{
+
+/*!\brief Invokes \p fn on every element of \p range (in order).
+ * \param range The range.
+ * \param fn The invocable.
+ * \returns \p fn
+ * \details
+ *
+ * Like std::ranges::for_each, but multi-pass ranges are iterated via radr::for_each_segment. This means that for
+ * e.g. `std::ref(vec_of_vec) | radr::join`, there is one plain loop over every inner vector (which the compiler can
+ * vectorise) instead of a single loop whose increment checks for the end of the inner range.
+ */
+template <std::ranges::input_range Range, typename Fn>
+    requires std::invocable<Fn &, std::ranges::range_reference_t<Range>>
+constexpr Fn for_each(Range && range, Fn fn)
+{
+    auto loop = [&fn](auto && rng)
+    {
+        for (auto && elem : rng)
+            std::invoke(fn, std::forward<decltype(elem)>(elem));
+    };
+
+    if constexpr (borrowed_mp_range<Range &>)
+        radr::for_each_segment(range, loop);
+    else
+        loop(range);
+
+    return fn;
+}
+
+} // namespace radr
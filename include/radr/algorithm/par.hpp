@@ -0,0 +1,257 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Copyright (c) 2023-2025 Hannes Hauswedell
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See the LICENSE file for details.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <ranges>
+#include <vector>
+
+#include "../concepts.hpp"
+#include "../custom/subdivide.hpp"
+#include "../detail/thread_pool.hpp"
+#include "../range_access.hpp"
+
+namespace radr::detail
+{
+
+//!\brief The number of parts per thread that ranges are cut into (more parts → better load-balancing).
+inline constexpr size_t par_parts_per_thread = 8;
+
+//!\brief Shared state between radr::detail::par_run and the helpers it submits to the radr::detail::task_pool.
+struct par_run_state
+{
+    std::mutex              mtx;
+    std::condition_variable cv;
+    bool                    closed  = false;
+    size_t                  running = 0;
+};
+
+/*!\brief Invokes `task(i)` for every i in [0, n) on up to \p threads threads (including the calling thread).
+ * \details
+ *
+ * The calling thread is helped by `threads - 1` threads of radr::detail::shared_task_pool(), so no threads are created
+ * per call (only if the pool is smaller than requested). The tasks are not assigned to threads up front; every thread
+ * repeatedly takes the next index from a shared counter, so threads that finish early take over the remaining work.
+ * Helpers that have not started when the calling thread runs out of work are skipped; thus nested calls and
+ * concurrent calls from multiple threads cannot deadlock, but they share the pool's threads.
+ *
+ * If a task throws, no further tasks are started and the (first) exception is rethrown after all threads have
+ * finished.
+ */
+template <typename Task>
+void par_run(size_t const n, size_t threads, Task & task)
+{
+    threads = std::min(threads, n);
+
+    std::atomic<size_t> next{0};
+    std::exception_ptr  error{};
+    std::mutex          error_mtx;
+
+    auto work = [&]()
+    {
+        while (true)
+        {
+            size_t const i = next.fetch_add(1, std::memory_order_relaxed);
+            if (i >= n)
+                return;
+
+            try
+            {
+                task(i);
+            }
+            catch (...)
+            {
+                std::lock_guard lock{error_mtx};
+                if (!error)
+                    error = std::current_exception();
+                next.store(n, std::memory_order_relaxed);
+            }
+        }
+    };
+
+    if (threads > 1)
+    {
+        auto        state = std::make_shared<par_run_state>();
+        task_pool & pool  = shared_task_pool();
+        pool.reserve(threads - 1);
+
+        /* work is only accessed by helpers that start before the state is closed */
+        for (size_t t = 1; t < threads; ++t)
+        {
+            pool.submit(
+              [state, &work]()
+              {
+                  {
+                      std::lock_guard lock{state->mtx};
+                      if (state->closed)
+                          return;
+                      ++state->running;
+                  }
+                  work();
+                  {
+                      std::lock_guard lock{state->mtx};
+                      --state->running;
+                  }
+                  state->cv.notify_all();
+              });
+        }
+
+        work();
+
+        std::unique_lock lock{state->mtx};
+        state->closed = true;
+        state->cv.wait(lock, [&state] { return state->running == 0; });
+    }
+    else
+    {
+        work();
+    }
+
+    if (error)
+        std::rethrow_exception(error);
+}
+
+//!\brief The number of threads to use for the parallel algorithms (0 → default).
+inline size_t par_thread_count(size_t const threads) noexcept
+{
+    return threads == 0 ? default_thread_count() : threads;
+}
+
+/*!\brief Cut the range via radr::subdivide and invoke `part_fn(i, part)` on every part in parallel.
+ * \details
+ *
+ * The range is cut into at most `threads * par_parts_per_thread` parts; \p threads must not be 0.
+ */
+template <typename Range, typename PartFn>
+void par_parts(Range & range, size_t const threads, PartFn part_fn)
+{
+    auto parts = subdivide(range, threads * par_parts_per_thread);
+    auto task  = [&](size_t const i) { part_fn(i, parts[i]); };
+    par_run(parts.size(), threads, task);
+}
+
+} // namespace radr::detail
+
+namespace radr::par
+{
+
+/*!\brief Invokes \p fn on every element of \p range, using multiple threads.
+ * \param range The range; a multi-pass range, e.g. a container or a pipeline of radr adaptors.
+ * \param fn The invocable; it is called concurrently (as const) from multiple threads.
+ * \param threads The number of threads; 0 (the default) means std::thread::hardware_concurrency().
+ * \details
+ *
+ * The range is cut into parts via radr::subdivide (this is exact and O(1) for random-access pipelines, like
+ * `std::ref(vec) | radr::transform(f) | radr::take(n)`; radr::filter and radr::join are cut on their underlying
+ * range). The parts are then processed by the calling thread and `threads - 1` threads of a shared, persistent pool,
+ * where idle threads take the next unprocessed part. The order in which elements are visited is unspecified.
+ *
+ * If \p fn throws, the exception is propagated to the caller (some elements might not have been visited).
+ */
+template <std::ranges::forward_range Range, typename Fn>
+    requires(borrowed_mp_range<Range &> && std::invocable<Fn const &, std::ranges::range_reference_t<Range &>>)
+void for_each(Range && range, Fn const fn, size_t const threads = 0)
+{
+    detail::par_parts(range,
+                      detail::par_thread_count(threads),
+                      [&fn](size_t, auto & part)
+                      {
+                          for (auto && elem : part)
+                              std::invoke(fn, std::forward<decltype(elem)>(elem));
+                      });
+}
+
+/*!\brief Returns the number of elements in \p range that satisfy \p pred, using multiple threads.
+ * \param range The range; a multi-pass range.
+ * \param pred The predicate; it is called concurrently (as const) from multiple threads.
+ * \param threads The number of threads; 0 (the default) means std::thread::hardware_concurrency().
+ * \details
+ *
+ * See radr::par::for_each.
+ */
+template <std::ranges::forward_range Range, typename Pred>
+    requires(borrowed_mp_range<Range &> && std::predicate<Pred const &, std::ranges::range_reference_t<Range &>>)
+std::ranges::range_difference_t<Range> count_if(Range && range, Pred const pred, size_t const threads = 0)
+{
+    using diff_t = std::ranges::range_difference_t<Range>;
+
+    size_t const        t = detail::par_thread_count(threads);
+    std::vector<diff_t> counts(t * detail::par_parts_per_thread);
+
+    detail::par_parts(range,
+                      t,
+                      [&](size_t const i, auto & part)
+                      {
+                          diff_t c = 0;
+                          for (auto && elem : part)
+                              c += static_cast<bool>(std::invoke(pred, std::forward<decltype(elem)>(elem)));
+                          counts[i] = c;
+                      });
+
+    diff_t ret = 0;
+    for (diff_t const c : counts)
+        ret += c;
+    return ret;
+}
+
+/*!\brief Combines the elements of \p range and \p init via \p op, using multiple threads.
+ * \param range The range; a multi-pass range.
+ * \param init The initial value.
+ * \param op The binary operation; it needs to be associative and is called concurrently (as const).
+ * \param threads The number of threads; 0 (the default) means std::thread::hardware_concurrency().
+ * \details
+ *
+ * Every part of the range (see radr::par::for_each) is reduced left-to-right, and the partial results are combined
+ * left-to-right with \p init in front. In contrast to std::reduce, \p op need not be commutative.
+ */
+template <std::ranges::forward_range Range, typename T, typename Op = std::plus<>>
+    requires(borrowed_mp_range<Range &> && std::move_constructible<T> &&
+             std::constructible_from<T, std::ranges::range_reference_t<Range &>> &&
+             std::invocable<Op const &, T, std::ranges::range_reference_t<Range &>> &&
+             std::invocable<Op const &, T, T> &&
+             std::assignable_from<T &, std::invoke_result_t<Op const &, T, std::ranges::range_reference_t<Range &>>> &&
+             std::assignable_from<T &, std::invoke_result_t<Op const &, T, T>>)
+T reduce(Range && range, T init, Op const op = {}, size_t const threads = 0)
+{
+    size_t const                  t = detail::par_thread_count(threads);
+    std::vector<std::optional<T>> partials(t * detail::par_parts_per_thread);
+
+    detail::par_parts(range,
+                      t,
+                      [&](size_t const i, auto & part)
+                      {
+                          auto it = radr::begin(part);
+                          auto e  = radr::end(part);
+                          if (it == e)
+                              return;
+
+                          T acc(*it);
+                          for (++it; it != e; ++it)
+                              acc = std::invoke(op, std::move(acc), *it);
+                          partials[i].emplace(std::move(acc));
+                      });
+
+    for (std::optional<T> & p : partials)
+        if (p)
+            init = std::invoke(op, std::move(init), std::move(*p));
+    return init;
+}
+
+} // namespace radr::par
@@ -0,0 +1,73 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Copyright (c) 2023-2025 Hannes Hauswedell
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See the LICENSE file for details.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include <ranges>
+
+#include "../concepts.hpp"
+#include "../detail/detail.hpp"
+#include "../range_access.hpp"
+#include "subborrow.hpp"
+#include "tags.hpp"
+
+namespace radr
+{
+
+//=============================================================================
+// Wrapper function for_each_segment
+//=============================================================================
+
+/*!\brief Invoke a function on consecutive subranges ("segments") that together make up a multi-pass range.
+ * \details
+ *
+ * This is the segmented iteration protocol used by the algorithms in radr/algorithm/. Ranges whose iterators are
+ * expensive to increment, because they walk over a nested structure, can hand out the (flat) parts of that structure
+ * instead, so that algorithms run a tight loop per segment. For example, the segments of
+ * `std::ref(vec_of_vec) | radr::join` are the inner vectors as ranges of pointers, which the compiler can vectorise.
+ *
+ * The segments are borrowed ranges (see radr::subborrow) and are passed to \p fn in order. Segments may be empty.
+ * Segments are segmented recursively, so nested joins are reduced to their innermost ranges.
+ *
+ * The default implementation passes the whole range as a single segment.
+ *
+ * Iterators can provide a better implementation by defining the following as a hidden friend:
+ *
+ * ```cpp
+ * template <radr::borrowed_mp_range R, typename Fn>
+ * friend void tag_invoke(radr::custom::for_each_segment_tag, R && urange, It b, Sen e, Fn & fn);
+ * ```
+ *
+ * This is done by the iterator of radr::join.
+ */
+struct for_each_segment_impl_t
+{
+    //!\brief Call tag_invoke if possible; pass [b, e) as single segment otherwise. [it, sen, fn]
+    template <borrowed_mp_range URange, detail::is_iterator_of<URange> It, typename Sen, typename Fn>
+    constexpr void operator()(URange && urange, It const b, Sen const e, Fn && fn) const
+    {
+        if constexpr (requires { tag_invoke(custom::for_each_segment_tag{}, std::forward<URange>(urange), b, e, fn); })
+            tag_invoke(custom::for_each_segment_tag{}, std::forward<URange>(urange), b, e, fn);
+        else
+            fn(subborrow(urange, b, e));
+    }
+
+    //!\brief Segment the whole range. [fn]
+    template <borrowed_mp_range URange, typename Fn>
+    constexpr void operator()(URange && urange, Fn && fn) const
+    {
+        operator()(std::forward<URange>(urange), radr::begin(urange), radr::end(urange), fn);
+    }
+};
+
+inline constexpr for_each_segment_impl_t for_each_segment{};
+
+} // namespace radr
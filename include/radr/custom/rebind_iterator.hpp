@@ -14,29 +14,142 @@
 #include <cassert>
 #include <iterator>
 #include <ranges>
+#include <utility>
 
 #include "../range_access.hpp"
 #include "tags.hpp"
 
 namespace radr::detail
 {
+
+/*!\brief Whether a container provides index-based rebind hooks for the iterator type.
+ * \details
+ *
+ * Containers (that are not random-access) can provide the following hooks to make rebinding fast:
+ *
+ * ```cpp
+ * // return the index of it in c
+ * friend std::ptrdiff_t tag_invoke(radr::custom::rebind_index_tag, my_container const & c, It it);
+ * // return an iterator of type It at index i in c
+ * friend It tag_invoke(radr::custom::rebind_index_tag, my_container & c, It, std::ptrdiff_t i);
+ * ```
+ */
+template <typename It, typename Container>
+concept has_rebind_index_hooks = requires(It it, Container & c, std::ranges::range_difference_t<Container> i) {
+    {
+        tag_invoke(custom::rebind_index_tag{}, std::as_const(c), it)
+    } -> std::convertible_to<std::ranges::range_difference_t<Container>>;
+    {
+        tag_invoke(custom::rebind_index_tag{}, c, it, i)
+    } -> std::same_as<It>;
+};
+
 template <typename It, typename Container, typename BegFn>
 constexpr It tag_invoke_rebind_final_impl(It it, Container & container_old, Container & container_new, BegFn beg_fn)
 {
-    ptrdiff_t offset = std::ranges::distance(beg_fn(container_old), it);
-    assert(offset >= 0);
-
-    if constexpr (std::ranges::sized_range<Container>)
+    if constexpr (has_rebind_index_hooks<It, Container>)
     {
-        assert(offset <= ptrdiff_t(std::ranges::size(container_old)));
-        assert(std::ranges::size(container_old) == std::ranges::size(container_new));
+        std::ranges::range_difference_t<Container> const i =
+          tag_invoke(custom::rebind_index_tag{}, std::as_const(container_old), it);
+        return tag_invoke(custom::rebind_index_tag{}, container_new, it, i);
     }
+    else
+    {
+        ptrdiff_t offset = std::ranges::distance(beg_fn(container_old), it);
+        assert(offset >= 0);
+
+        if constexpr (std::ranges::sized_range<Container>)
+        {
+            assert(offset <= ptrdiff_t(std::ranges::size(container_old)));
+            assert(std::ranges::size(container_old) == std::ranges::size(container_new));
+        }
 
-    auto ret = beg_fn(container_new);
-    std::ranges::advance(ret, offset);
-    return ret;
+        auto ret = beg_fn(container_new);
+        std::ranges::advance(ret, offset);
+        return ret;
+    }
 }
 
+/*!\brief Rebinds multiple iterators from one container to another in a single simultaneous walk.
+ * \tparam Container The container type.
+ * \details
+ *
+ * Iterators are rebound by advancing a pair of cursors (one per container) in lockstep until the cursor in the old
+ * container is equal to the iterator. If iterators are rebound in ascending order (which is typically the case),
+ * all iterators of a range are rebound in a single pass over the containers.
+ * Otherwise, the walk restarts at the beginning.
+ *
+ * The walker is passed as both, the "old" and the "new" container, to the rebind customisations of adaptor
+ * iterators; the recursion anchors for the container's iterators (see below) then call operator().
+ */
+template <std::ranges::forward_range Container>
+class rebind_walker
+{
+    using cursor_t = std::ranges::iterator_t<Container>;
+
+    Container * container_old = nullptr;
+    Container * container_new = nullptr;
+    cursor_t    cursor_old{};
+    cursor_t    cursor_new{};
+
+public:
+    constexpr rebind_walker(Container & old, Container & new_) :
+      container_old{&old},
+      container_new{&new_},
+      cursor_old{std::ranges::begin(old)},
+      cursor_new{std::ranges::begin(new_)}
+    {}
+
+    template <typename It>
+        requires std::equality_comparable_with<cursor_t, It> && std::constructible_from<It, cursor_t>
+    constexpr It operator()(It const & it)
+    {
+        if constexpr (has_rebind_index_hooks<It, Container>)
+        {
+            return tag_invoke_rebind_final_impl(it, *container_old, *container_new, std::ranges::begin);
+        }
+        else
+        {
+            if constexpr (std::ranges::common_range<Container>)
+                if (it == std::ranges::end(*container_old))
+                    return It(std::ranges::end(*container_new));
+
+            for (int pass = 0; pass < 2; ++pass)
+            {
+                for (;; ++cursor_old, ++cursor_new)
+                {
+                    if (cursor_old == it)
+                        return It(cursor_new);
+                    if (cursor_old == std::ranges::end(*container_old))
+                        break;
+                }
+
+                cursor_old = std::ranges::begin(*container_old);
+                cursor_new = std::ranges::begin(*container_new);
+            }
+
+            assert(false); // iterator is not part of the container
+            return It(std::ranges::next(std::ranges::begin(*container_new), std::ranges::end(*container_new)));
+        }
+    }
+};
+
+//!\brief The container type that iterators are rebound to (resolves radr::detail::rebind_walker).
+template <typename Container>
+struct rebind_container
+{
+    using type = Container;
+};
+
+template <typename Container>
+struct rebind_container<rebind_walker<Container>>
+{
+    using type = Container;
+};
+
+template <typename Container>
+using rebind_container_t = typename rebind_container<Container>::type;
+
 } // namespace radr::detail
 
 namespace radr::custom
@@ -67,7 +180,7 @@ constexpr auto tag_invoke(rebind_iterator_tag, std::default_sentinel_t, Containe
  * Potentially, we could also check for no-throw copy construction, which most sentinels should be.
  */
 template <std::semiregular It, typename Container>
-    requires(!detail::is_iterator_of<It, Container> &&
+    requires(!detail::is_iterator_of<It, detail::rebind_container_t<Container>> &&
              requires(It it) {
                  {
                      it.base()
@@ -80,6 +193,17 @@ constexpr It tag_invoke(rebind_iterator_tag, It it, Container & container_old, C
     return It{tag_invoke(custom::rebind_iterator_tag{}, std::move(it).base(), container_old, container_new)};
 }
 
+//!\brief Recursion anchor for all iterator types of the container (batched rebind).
+template <typename It, typename Container>
+    requires(detail::is_iterator_of<It, Container> && std::invocable<detail::rebind_walker<Container> &, It const &>)
+constexpr It tag_invoke(rebind_iterator_tag,
+                        It                                  it,
+                        detail::rebind_walker<Container> & walker,
+                        detail::rebind_walker<Container> &)
+{
+    return walker(it);
+}
+
 //!\brief Recursion anchor for iterator type.
 template <typename Container>
 constexpr iterator_t<Container> tag_invoke(rebind_iterator_tag,
@@ -132,4 +256,14 @@ template <typename T, typename Container>
 concept rebindable_iterator_to =
   requires(T it, Container & container) { tag_invoke(custom::rebind_iterator_tag{}, it, container, container); };
 
-}
+} // namespace radr
+
+namespace radr::detail
+{
+
+//!\brief Whether rebinding should happen via radr::detail::rebind_walker (only beneficial if not random-access).
+template <typename T, typename Container>
+concept batch_rebindable_iterator_to =
+  !std::ranges::random_access_range<Container> && rebindable_iterator_to<T, rebind_walker<Container>>;
+
+} // namespace radr::detail
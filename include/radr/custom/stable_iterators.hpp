@@ -0,0 +1,66 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Copyright (c) 2023-2025 Hannes Hauswedell
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See the LICENSE file for details.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include <deque>
+#include <memory>
+#include <vector>
+
+#include "radr/version.hpp"
+
+namespace radr::detail
+{
+
+//!\brief Move-assignment steals the buffer (instead of moving element-wise) for these allocators.
+template <typename Alloc>
+inline constexpr bool allocator_steals_on_move_assign =
+  std::allocator_traits<Alloc>::propagate_on_container_move_assignment::value ||
+  std::allocator_traits<Alloc>::is_always_equal::value;
+
+} // namespace radr::detail
+
+namespace radr::custom
+{
+
+/*!\brief Opt-in trait for containers whose iterators remain valid when the container is moved.
+ * \tparam Container The container type.
+ * \details
+ *
+ * If this is true for a container, radr::owning_rad stores the container directly instead of in heap-allocated
+ * indirect storage. To be correct, iterators, sentinels and the iterators of all radr::borrowing_rad created on the
+ * container need to remain valid after the container has been move-constructed **and** move-assigned.
+ *
+ * The trait is true for std::vector and, with libstdc++ and libc++, for std::deque (as long as their allocator is
+ * moved along with the buffer). Other standard libraries may store a pointer to the deque in its iterators (MSVC's STL
+ * does). It is false for std::basic_string, because the small-string-optimisation invalidates iterators on move.
+ *
+ * You may specialise this for your own container types:
+ *
+ * ```cpp
+ * template <>
+ * inline constexpr bool radr::custom::stable_iterators_on_move<my_container> = true;
+ * ```
+ */
+template <typename Container>
+inline constexpr bool stable_iterators_on_move = false;
+
+//!\brief Specialisation for std::vector.
+template <typename T, typename Alloc>
+inline constexpr bool stable_iterators_on_move<std::vector<T, Alloc>> = detail::allocator_steals_on_move_assign<Alloc>;
+
+#if defined(__GLIBCXX__) || defined(_LIBCPP_VERSION)
+//!\brief Specialisation for std::deque (only for standard libraries whose deque iterators don't point to the deque).
+template <typename T, typename Alloc>
+inline constexpr bool stable_iterators_on_move<std::deque<T, Alloc>> = detail::allocator_steals_on_move_assign<Alloc>;
+#endif
+
+} // namespace radr::custom
@@ -0,0 +1,121 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Copyright (c) 2023-2025 Hannes Hauswedell
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See the LICENSE file for details.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <ranges>
+#include <vector>
+
+#include "../concepts.hpp"
+#include "../detail/detail.hpp"
+#include "../range_access.hpp"
+#include "subborrow.hpp"
+#include "tags.hpp"
+
+namespace radr
+{
+
+//=============================================================================
+// Wrapper function subdivide
+//=============================================================================
+
+/*!\brief Cut a multi-pass range into (at most) k consecutive, non-overlapping subranges.
+ * \details
+ *
+ * This is the basis of the parallel algorithms in radr/algorithm/par.hpp. The returned subranges are borrowed
+ * ranges (see radr::subborrow), and they are stored in a std::vector. Empty subranges are not returned, so fewer than
+ * k subranges are returned for short ranges (and none for empty ranges).
+ *
+ * The default implementation cuts random-access ranges with sized sentinels into parts that have the same size
+ * (± 1) in O(k). For other ranges, it walks over the range twice (once to count and once to cut), so the parts are
+ * balanced, but the cost is linear.
+ *
+ * Iterators can provide a better implementation by defining the following as a hidden friend:
+ *
+ * ```cpp
+ * template <radr::borrowed_mp_range R>
+ * friend std::vector<PartType> tag_invoke(radr::custom::subdivide_tag, R && urange, It b, Sen e, size_t k);
+ * ```
+ *
+ * This is done by the iterators of radr::filter and radr::join which cut the underlying (random-access) range
+ * instead; the parts are then not balanced by the number of elements, but by the number of underlying elements.
+ */
+struct subdivide_impl_t
+{
+    /*!\brief Default implementation.
+     * \param r Range the iterators originate from (just used as tag).
+     * \param b Begin of the range.
+     * \param e End of the range.
+     * \param k The maximum number of parts.
+     */
+    template <borrowed_mp_range URange, detail::is_iterator_of<URange> It, typename Sen>
+    static constexpr auto default_(URange && r, It const b, Sen const e, size_t const k)
+    {
+        using part_t = decltype(subborrow(r, b, b, size_t{}));
+        std::vector<part_t> parts;
+
+        size_t n = 0;
+        if constexpr (std::sized_sentinel_for<Sen, It>)
+            n = static_cast<size_t>(e - b);
+        else
+            n = static_cast<size_t>(std::ranges::distance(b, e));
+
+        size_t const p = std::min(k, n);
+        parts.reserve(p);
+
+        It it = b;
+        for (size_t i = 0; i < p; ++i)
+        {
+            size_t const len  = n * (i + 1) / p - n * i / p;
+            It           next = std::ranges::next(it, static_cast<std::iter_difference_t<It>>(len));
+            parts.push_back(subborrow(r, it, next, len));
+            it = std::move(next);
+        }
+
+        return parts;
+    }
+
+    //!\brief Call tag_invoke if possible; call default otherwise. [it, sen, k]
+    template <borrowed_mp_range URange, detail::is_iterator_of<URange> It, typename Sen>
+    constexpr auto operator()(URange && urange, It const b, Sen const e, size_t const k) const
+    {
+        assert(k > 0);
+
+        if constexpr (requires { tag_invoke(custom::subdivide_tag{}, std::forward<URange>(urange), b, e, k); })
+        {
+            using ret_t = decltype(tag_invoke(custom::subdivide_tag{}, std::forward<URange>(urange), b, e, k));
+            static_assert(std::ranges::random_access_range<ret_t> &&
+                            radr::borrowed_mp_range_object<std::ranges::range_value_t<ret_t>>,
+                          "Your customisations of radr::subdivide must always return a random-access range of "
+                          "radr::borrowed_mp_range_object.");
+            return tag_invoke(custom::subdivide_tag{}, std::forward<URange>(urange), b, e, k);
+        }
+        else
+        {
+            return default_(std::forward<URange>(urange), b, e, k);
+        }
+    }
+
+    //!\brief Subdivide the whole range. [k]
+    template <borrowed_mp_range URange>
+    constexpr auto operator()(URange && urange, size_t const k) const
+    {
+        return operator()(std::forward<URange>(urange), radr::begin(urange), radr::end(urange), k);
+    }
+};
+
+inline constexpr subdivide_impl_t subdivide{};
+
+} // namespace radr
@@ -19,10 +19,22 @@ namespace radr::custom
 struct rebind_iterator_tag
 {};
 
+struct rebind_index_tag
+{};
+
 struct subborrow_tag
 {};
 
 struct find_common_end_tag
 {};
 
+struct subdivide_tag
+{};
+
+struct for_each_segment_tag
+{};
+
+struct copy_tag
+{};
+
 } // namespace radr::custom
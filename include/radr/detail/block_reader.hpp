@@ -0,0 +1,118 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Copyright (c) 2023-2025 Hannes Hauswedell
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See the LICENSE file for details.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstring>
+#include <streambuf>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#if __has_include(<unistd.h>)
+#    include <unistd.h>
+#endif
+
+namespace radr::detail
+{
+
+/*!\brief A buffer that is filled in large blocks from ReadFn, keeping the unprocessed tail of the previous block.
+ * \tparam ReadFn Callable as `std::size_t(char * dest, std::size_t n)`; returns the number of bytes read (0 at end).
+ * \details
+ *
+ * This is used by the factories that read from streams and file descriptors (radr::parse, radr::lines).
+ */
+template <typename ReadFn>
+class block_reader
+{
+    [[no_unique_address]] ReadFn read_fn;
+    std::vector<char>            buffer{};
+
+public:
+    static constexpr std::size_t block_size = 1 << 16;
+
+    explicit block_reader(ReadFn fn) : read_fn{std::move(fn)} {}
+
+    char const * begin() const noexcept { return buffer.data(); }
+    char const * end() const noexcept { return buffer.data(); }
+
+    /*!\brief Keep [it, e) and append the next block.
+     * \details
+     *
+     * The buffer grows (at least doubling its size) if [it, e) is larger than the free space. Both pointers are updated
+     * to point into the (possibly new) buffer. Returns false if no more data could be read.
+     *
+     * If [it, e) is already at the start of the buffer (e.g. a line that spans multiple blocks), it is not copied, so
+     * long lines are copied only when the buffer grows.
+     */
+    bool refill(char const *& it, char const *& e)
+    {
+        std::size_t const keep = static_cast<std::size_t>(e - it);
+
+        if (buffer.size() < keep + block_size)
+        {
+            /* grow geometrically, so that very long lines are not reallocated once per block */
+            std::vector<char> new_buffer(std::max(2 * buffer.size(), keep + block_size));
+            if (keep > 0)
+                std::memcpy(new_buffer.data(), it, keep);
+            buffer = std::move(new_buffer);
+        }
+        else if (keep > 0 && it != buffer.data())
+        {
+            std::memmove(buffer.data(), it, keep);
+        }
+
+        std::size_t const n = read_fn(buffer.data() + keep, block_size);
+
+        it = buffer.data();
+        e  = buffer.data() + keep + n;
+        return n > 0;
+    }
+};
+
+//!\brief ReadFn for radr::detail::block_reader that reads from a streambuf.
+template <typename Traits>
+struct streambuf_read_fn
+{
+    std::basic_streambuf<char, Traits> * buf = nullptr;
+
+    std::size_t operator()(char * const dest, std::size_t const n) const
+    {
+        std::streamsize const res = buf->sgetn(dest, static_cast<std::streamsize>(n));
+        return res > 0 ? static_cast<std::size_t>(res) : 0;
+    }
+};
+
+#if __has_include(<unistd.h>)
+//!\brief ReadFn for radr::detail::block_reader that reads from a POSIX file descriptor.
+struct fd_read_fn
+{
+    int fd = -1;
+
+    //!\throws std::system_error if reading fails.
+    std::size_t operator()(char * const dest, std::size_t const n) const
+    {
+        while (true)
+        {
+            ::ssize_t const res = ::read(fd, dest, n);
+            if (res >= 0)
+                return static_cast<std::size_t>(res);
+            if (errno != EINTR)
+                throw std::system_error{errno, std::system_category(), "radr: reading from file descriptor failed"};
+        }
+    }
+};
+#endif
+
+} // namespace radr::detail
@@ -11,50 +11,154 @@
 
 #pragma once
 
+#include <cassert>
 #include <compare>
 #include <concepts>
 #include <memory>
+#include <utility>
+
+#include "../custom/stable_iterators.hpp"
 
 namespace radr::detail
 {
 
-template <std::copyable T>
+/*!\brief Heap-allocated storage for a single value with value semantics.
+ * \tparam T The value type.
+ * \tparam Alloc The allocator used for the single allocation; follows the usual allocator propagation rules.
+ */
+template <std::copyable T, typename Alloc = std::allocator<T>>
 class indirect
 {
 private:
-    std::unique_ptr<T> data;
+    using alloc_t  = typename std::allocator_traits<Alloc>::template rebind_alloc<T>;
+    using traits_t = std::allocator_traits<alloc_t>;
+
+    T *                           data = nullptr;
+    [[no_unique_address]] alloc_t alloc{};
+
+    template <typename... Args>
+    constexpr void emplace(Args &&... args)
+    {
+        T * ptr = traits_t::allocate(alloc, 1);
+        try
+        {
+            traits_t::construct(alloc, ptr, std::forward<Args>(args)...);
+        }
+        catch (...)
+        {
+            traits_t::deallocate(alloc, ptr, 1);
+            throw;
+        }
+        data = ptr;
+    }
+
+    constexpr void reset() noexcept
+    {
+        if (data)
+        {
+            traits_t::destroy(alloc, data);
+            traits_t::deallocate(alloc, data, 1);
+            data = nullptr;
+        }
+    }
 
 public:
-    constexpr indirect() noexcept
-        requires std::default_initializable<T>
-      : data{new T{}}
-    {}
+    using allocator_type = alloc_t;
+
+    //!\brief Whether move-assignment always steals the pointer (and never moves element-wise).
+    static constexpr bool steals_on_move_assign = allocator_steals_on_move_assign<alloc_t>;
+
+    constexpr indirect()
+        requires(std::default_initializable<T> && std::default_initializable<alloc_t>)
+    {
+        emplace();
+    }
     //!\brief This is different from the proposed one but useful for us.
     constexpr indirect() noexcept
-        requires(!std::default_initializable<T>)
+        requires(!std::default_initializable<T> && std::default_initializable<alloc_t>)
     = default;
 
-    constexpr indirect(indirect &&) noexcept             = default;
-    constexpr indirect & operator=(indirect &&) noexcept = default;
+    constexpr indirect(indirect && rhs) noexcept :
+      data{std::exchange(rhs.data, nullptr)}, alloc{std::move(rhs.alloc)}
+    {}
+
+    constexpr indirect & operator=(indirect && rhs) noexcept(steals_on_move_assign)
+    {
+        if (this == &rhs)
+            return *this;
+
+        if constexpr (traits_t::propagate_on_container_move_assignment::value)
+        {
+            reset();
+            alloc = std::move(rhs.alloc);
+            data  = std::exchange(rhs.data, nullptr);
+        }
+        else if (steals_on_move_assign || alloc == rhs.alloc)
+        {
+            reset();
+            data = std::exchange(rhs.data, nullptr);
+        }
+        else if (rhs.data == nullptr)
+        {
+            reset();
+        }
+        else if (data)
+        {
+            *data = std::move(*rhs.data);
+        }
+        else
+        {
+            emplace(std::move(*rhs.data));
+        }
+
+        return *this;
+    }
 
-    constexpr indirect(indirect const & rhs) { *this = rhs; }
+    constexpr indirect(indirect const & rhs) :
+      alloc{traits_t::select_on_container_copy_construction(rhs.alloc)}
+    {
+        if (rhs.data)
+            emplace(*rhs.data);
+    }
 
     constexpr indirect & operator=(indirect const & rhs)
     {
-        if (data == rhs.data)
+        if (this == &rhs)
+            return *this;
+
+        if constexpr (traits_t::propagate_on_container_copy_assignment::value)
         {
+            if (alloc != rhs.alloc)
+            {
+                reset();
+                alloc = rhs.alloc;
+            }
         }
-        else if (rhs.data == nullptr)
-            data.reset(nullptr);
+
+        if (rhs.data == nullptr)
+            reset();
         else if (data)
             *data = *rhs.data;
         else
-            data.reset(new T(*rhs.data));
+            emplace(*rhs.data);
 
         return *this;
     }
 
-    constexpr indirect(std::convertible_to<T> auto && val) : data{new T(std::forward<decltype(val)>(val))} {}
+    constexpr ~indirect() { reset(); }
+
+    constexpr indirect(std::convertible_to<T> auto && val)
+        requires std::default_initializable<alloc_t>
+    {
+        emplace(std::forward<decltype(val)>(val));
+    }
+
+    constexpr indirect(std::allocator_arg_t, alloc_t const & a, std::convertible_to<T> auto && val) : alloc{a}
+    {
+        emplace(std::forward<decltype(val)>(val));
+    }
+
+    constexpr allocator_type get_allocator() const noexcept { return alloc; }
 
     constexpr T & operator*() & noexcept
     {
@@ -74,7 +178,7 @@ public:
         return std::move(*data);
     }
 
-    constexpr T * get() const noexcept { return data.get(); }
+    constexpr T * get() const noexcept { return data; }
 
     constexpr friend auto operator<=>(indirect const & lhs, indirect const & rhs)
         requires std::three_way_comparable<T>
@@ -93,4 +197,52 @@ public:
     }
 };
 
+/*!\brief Stores the value directly, but provides the same interface as radr::detail::indirect.
+ * \details
+ *
+ * This is used instead of radr::detail::indirect for types where radr::custom::stable_iterators_on_move is true.
+ */
+template <std::copyable T>
+class direct
+{
+private:
+    [[no_unique_address]] T data{};
+
+public:
+    constexpr direct()                           = default;
+    constexpr direct(direct &&)                  = default;
+    constexpr direct & operator=(direct &&)      = default;
+    constexpr direct(direct const &)             = default;
+    constexpr direct & operator=(direct const &) = default;
+
+    constexpr direct(std::convertible_to<T> auto && val) : data(std::forward<decltype(val)>(val)) {}
+
+    //!\brief The allocator is ignored, because there is no separate allocation.
+    constexpr direct(std::allocator_arg_t, auto const &, std::convertible_to<T> auto && val) :
+      data(std::forward<decltype(val)>(val))
+    {}
+
+    //!\brief Move-assignment never invalidates iterators into the stored value.
+    static constexpr bool steals_on_move_assign = true;
+
+    constexpr T &       operator*() & noexcept { return data; }
+    constexpr T const & operator*() const & noexcept { return data; }
+    constexpr T &&      operator*() && noexcept { return std::move(data); }
+
+    //!\brief Same as indirect::get(), this does not propagate const.
+    constexpr T * get() const noexcept { return const_cast<T *>(std::addressof(data)); }
+
+    constexpr friend auto operator<=>(direct const & lhs, direct const & rhs)
+        requires std::three_way_comparable<T>
+    {
+        return *lhs <=> *rhs;
+    }
+
+    constexpr friend bool operator==(direct const & lhs, direct const & rhs)
+        requires std::equality_comparable<T>
+    {
+        return *lhs == *rhs;
+    }
+};
+
 } // namespace radr::detail
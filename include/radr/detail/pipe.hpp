@@ -16,6 +16,7 @@
 
 #include "../custom/subborrow.hpp"
 #include "../rad_util/owning_rad.hpp"
+#include "../rad_util/shared_rad.hpp"
 #include "detail.hpp"
 
 namespace radr::detail
@@ -61,8 +62,13 @@ struct pipe_fwd_base
     {
         static_assert(mp_range<Range>, RADR_ASSERTSTRING_CONST_ITERABLE);
 
+        /* shared_rad (lvalues are fine, because copying is cheap) */
+        if constexpr (is_shared_rad<std::remove_cvref_t<Range>>)
+        {
+            return shared_rad{std::forward<Range>(range), detail::bind_back(BorrowFn{}, std::forward<Args>(args)...)};
+        }
         /* borrowing_rad */
-        if constexpr (std::ranges::borrowed_range<std::remove_reference_t<Range>>)
+        else if constexpr (std::ranges::borrowed_range<std::remove_reference_t<Range>>)
         {
             // we make sure that what we are forwarding is semiregular
             if constexpr (std::semiregular<std::remove_cvref_t<Range>>)
@@ -103,7 +109,11 @@ struct pipe_fwd_base
 
 template <bool non_empty_args>
 struct pipe_fwd_base<void, non_empty_args>
-{};
+{
+    struct noop_
+    {};
+    void operator()(noop_) {}
+};
 
 template <typename CoroFn, typename BorrowFn, bool closure = false>
 struct pipe_with_args_fn : pipe_input_base<CoroFn, true>, pipe_fwd_base<BorrowFn, true>
@@ -0,0 +1,870 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Copyright (c) 2023-2025 Hannes Hauswedell
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See the LICENSE file for details.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+/* Define RADR_NO_SIMD to disable the use of intrinsics (memchr is still used). */
+#if !defined(RADR_NO_SIMD) && defined(__AVX2__)
+#    include <immintrin.h>
+#    define RADR_SIMD_AVX2    1
+#    define RADR_SIMD_SHUFFLE 1
+#elif !defined(RADR_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64))
+#    include <emmintrin.h>
+#    define RADR_SIMD_SSE2 1
+#    if defined(__SSSE3__)
+#        include <tmmintrin.h>
+#        define RADR_SIMD_SHUFFLE 1
+#    endif
+#elif !defined(RADR_NO_SIMD) && defined(__ARM_NEON) && defined(__aarch64__)
+#    include <arm_neon.h>
+#    define RADR_SIMD_NEON    1
+#    define RADR_SIMD_SHUFFLE 1
+#endif
+
+namespace radr::detail
+{
+
+//!\brief Element types that radr::detail::simd_find handles; they are compared bitwise.
+template <typename T>
+concept simd_findable = std::integral<T> && !std::same_as<T, bool> && std::same_as<T, std::remove_cv_t<T>>;
+
+//!\brief Element types that radr::detail::simd_find_cmp handles.
+template <typename T>
+concept simd_comparable = simd_findable<T> || std::same_as<T, float> || std::same_as<T, double>;
+
+//!\brief Integral types of size 1 (other than bool); sets of these are stored as radr::detail::byte_set.
+template <typename T>
+concept byte_like = simd_findable<T> && sizeof(T) == 1;
+
+//!\brief The comparisons performed by radr::detail::simd_cmp_mask (element `op` value).
+enum class simd_cmp
+{
+    lt,
+    le,
+    gt,
+    ge
+};
+
+//!\brief Compares two scalars like radr::detail::simd_cmp_mask.
+template <simd_cmp Op, typename T>
+constexpr bool simd_cmp_scalar(T const x, T const v) noexcept
+{
+    if constexpr (Op == simd_cmp::lt)
+        return x < v;
+    else if constexpr (Op == simd_cmp::le)
+        return x <= v;
+    else if constexpr (Op == simd_cmp::gt)
+        return x > v;
+    else
+        return x >= v;
+}
+
+/*!\name Vector primitives
+ * \brief Load 16 or 32 bytes and compare them with a broadcast value.
+ * \details
+ *
+ * simd_eq_mask() returns a mask with simd_mask_bits_per_byte bits per byte of the vector (in memory order); all bits
+ * belonging to an element are set iff the element is equal to the value. So
+ * `std::countr_zero(mask) / (simd_mask_bits_per_byte * sizeof(T))` is the index of the first match, and masks of
+ * different positions can be combined via `&`. simd_full_mask has the bits of all elements set.
+ *
+ * simd_cmp_mask() is the same for ordered comparisons; floating point comparisons are false for NaN. Where
+ * simd_cmp_available is false for a type (64bit integers with only SSE2), it must not be called.
+ * \{
+ */
+#if defined(RADR_SIMD_AVX2)
+
+inline constexpr bool        simd_available          = true;
+inline constexpr size_t      simd_width              = 32;
+inline constexpr size_t      simd_mask_bits_per_byte = 1;
+using simd_vec_t                                     = __m256i;
+using simd_mask_t                                    = uint32_t;
+inline constexpr simd_mask_t simd_full_mask          = 0xFFFF'FFFFu;
+
+template <simd_comparable T>
+inline constexpr bool simd_cmp_available = true;
+
+template <simd_comparable T>
+inline simd_vec_t simd_broadcast(T const v) noexcept
+{
+    if constexpr (std::same_as<T, float>)
+        return _mm256_castps_si256(_mm256_set1_ps(v));
+    else if constexpr (std::same_as<T, double>)
+        return _mm256_castpd_si256(_mm256_set1_pd(v));
+    else if constexpr (sizeof(T) == 1)
+        return _mm256_set1_epi8(static_cast<char>(v));
+    else if constexpr (sizeof(T) == 2)
+        return _mm256_set1_epi16(static_cast<short>(v));
+    else if constexpr (sizeof(T) == 4)
+        return _mm256_set1_epi32(static_cast<int>(v));
+    else
+        return _mm256_set1_epi64x(static_cast<long long>(v));
+}
+
+template <simd_findable T>
+inline simd_mask_t simd_eq_mask(T const * const p, simd_vec_t const needle) noexcept
+{
+    simd_vec_t const block = _mm256_loadu_si256(reinterpret_cast<simd_vec_t const *>(p));
+    simd_vec_t       eq;
+    if constexpr (sizeof(T) == 1)
+        eq = _mm256_cmpeq_epi8(block, needle);
+    else if constexpr (sizeof(T) == 2)
+        eq = _mm256_cmpeq_epi16(block, needle);
+    else if constexpr (sizeof(T) == 4)
+        eq = _mm256_cmpeq_epi32(block, needle);
+    else
+        eq = _mm256_cmpeq_epi64(block, needle);
+    return static_cast<simd_mask_t>(_mm256_movemask_epi8(eq));
+}
+
+//!\brief Signed comparison `a > b`; unsigned values are compared after flipping the sign bits.
+template <simd_findable T>
+inline simd_vec_t simd_cmpgt(simd_vec_t a, simd_vec_t b) noexcept
+{
+    if constexpr (std::is_unsigned_v<T>)
+    {
+        simd_vec_t const sign = simd_broadcast(static_cast<T>(T{1} << (sizeof(T) * 8 - 1)));
+        a                     = _mm256_xor_si256(a, sign);
+        b                     = _mm256_xor_si256(b, sign);
+    }
+
+    if constexpr (sizeof(T) == 1)
+        return _mm256_cmpgt_epi8(a, b);
+    else if constexpr (sizeof(T) == 2)
+        return _mm256_cmpgt_epi16(a, b);
+    else if constexpr (sizeof(T) == 4)
+        return _mm256_cmpgt_epi32(a, b);
+    else
+        return _mm256_cmpgt_epi64(a, b);
+}
+
+template <simd_cmp Op, simd_comparable T>
+inline simd_mask_t simd_cmp_mask(T const * const p, simd_vec_t const v) noexcept
+{
+    if constexpr (std::floating_point<T>)
+    {
+        constexpr int pred = Op == simd_cmp::lt   ? _CMP_LT_OQ
+                             : Op == simd_cmp::le ? _CMP_LE_OQ
+                             : Op == simd_cmp::gt ? _CMP_GT_OQ
+                                                  : _CMP_GE_OQ;
+        if constexpr (std::same_as<T, float>)
+        {
+            __m256 const cmp = _mm256_cmp_ps(_mm256_loadu_ps(p), _mm256_castsi256_ps(v), pred);
+            return static_cast<simd_mask_t>(_mm256_movemask_epi8(_mm256_castps_si256(cmp)));
+        }
+        else
+        {
+            __m256d const cmp = _mm256_cmp_pd(_mm256_loadu_pd(p), _mm256_castsi256_pd(v), pred);
+            return static_cast<simd_mask_t>(_mm256_movemask_epi8(_mm256_castpd_si256(cmp)));
+        }
+    }
+    else
+    {
+        simd_vec_t const block = _mm256_loadu_si256(reinterpret_cast<simd_vec_t const *>(p));
+        if constexpr (Op == simd_cmp::lt)
+            return static_cast<simd_mask_t>(_mm256_movemask_epi8(simd_cmpgt<T>(v, block)));
+        else if constexpr (Op == simd_cmp::le)
+            return static_cast<simd_mask_t>(_mm256_movemask_epi8(simd_cmpgt<T>(block, v))) ^ simd_full_mask;
+        else if constexpr (Op == simd_cmp::gt)
+            return static_cast<simd_mask_t>(_mm256_movemask_epi8(simd_cmpgt<T>(block, v)));
+        else
+            return static_cast<simd_mask_t>(_mm256_movemask_epi8(simd_cmpgt<T>(v, block))) ^ simd_full_mask;
+    }
+}
+
+#elif defined(RADR_SIMD_SSE2)
+
+inline constexpr bool        simd_available          = true;
+inline constexpr size_t      simd_width              = 16;
+inline constexpr size_t      simd_mask_bits_per_byte = 1;
+using simd_vec_t                                     = __m128i;
+using simd_mask_t                                    = uint32_t;
+inline constexpr simd_mask_t simd_full_mask          = 0xFFFFu;
+
+// there is no 64bit integer comparison (before SSE4.2)
+template <simd_comparable T>
+inline constexpr bool simd_cmp_available = !std::integral<T> || sizeof(T) < 8;
+
+template <simd_comparable T>
+inline simd_vec_t simd_broadcast(T const v) noexcept
+{
+    if constexpr (std::same_as<T, float>)
+        return _mm_castps_si128(_mm_set1_ps(v));
+    else if constexpr (std::same_as<T, double>)
+        return _mm_castpd_si128(_mm_set1_pd(v));
+    else if constexpr (sizeof(T) == 1)
+        return _mm_set1_epi8(static_cast<char>(v));
+    else if constexpr (sizeof(T) == 2)
+        return _mm_set1_epi16(static_cast<short>(v));
+    else if constexpr (sizeof(T) == 4)
+        return _mm_set1_epi32(static_cast<int>(v));
+    else
+        return _mm_set1_epi64x(static_cast<long long>(v));
+}
+
+template <simd_findable T>
+inline simd_mask_t simd_eq_mask(T const * const p, simd_vec_t const needle) noexcept
+{
+    simd_vec_t const block = _mm_loadu_si128(reinterpret_cast<simd_vec_t const *>(p));
+    simd_vec_t       eq;
+    if constexpr (sizeof(T) == 1)
+        eq = _mm_cmpeq_epi8(block, needle);
+    else if constexpr (sizeof(T) == 2)
+        eq = _mm_cmpeq_epi16(block, needle);
+    else if constexpr (sizeof(T) == 4)
+        eq = _mm_cmpeq_epi32(block, needle);
+    else // no 64bit comparison in SSE2: both 32bit halves need to be equal
+    {
+        simd_vec_t const eq32 = _mm_cmpeq_epi32(block, needle);
+        eq                    = _mm_and_si128(eq32, _mm_shuffle_epi32(eq32, _MM_SHUFFLE(2, 3, 0, 1)));
+    }
+    return static_cast<simd_mask_t>(_mm_movemask_epi8(eq));
+}
+
+//!\brief Signed comparison `a > b`; unsigned values are compared after flipping the sign bits.
+template <simd_findable T>
+    requires(sizeof(T) < 8)
+inline simd_vec_t simd_cmpgt(simd_vec_t a, simd_vec_t b) noexcept
+{
+    if constexpr (std::is_unsigned_v<T>)
+    {
+        simd_vec_t const sign = simd_broadcast(static_cast<T>(T{1} << (sizeof(T) * 8 - 1)));
+        a                     = _mm_xor_si128(a, sign);
+        b                     = _mm_xor_si128(b, sign);
+    }
+
+    if constexpr (sizeof(T) == 1)
+        return _mm_cmpgt_epi8(a, b);
+    else if constexpr (sizeof(T) == 2)
+        return _mm_cmpgt_epi16(a, b);
+    else
+        return _mm_cmpgt_epi32(a, b);
+}
+
+template <simd_cmp Op, simd_comparable T>
+    requires simd_cmp_available<T>
+inline simd_mask_t simd_cmp_mask(T const * const p, simd_vec_t const v) noexcept
+{
+    if constexpr (std::same_as<T, float>)
+    {
+        __m128 const block = _mm_loadu_ps(p);
+        __m128 const value = _mm_castsi128_ps(v);
+        __m128 const cmp   = Op == simd_cmp::lt   ? _mm_cmplt_ps(block, value)
+                             : Op == simd_cmp::le ? _mm_cmple_ps(block, value)
+                             : Op == simd_cmp::gt ? _mm_cmpgt_ps(block, value)
+                                                  : _mm_cmpge_ps(block, value);
+        return static_cast<simd_mask_t>(_mm_movemask_epi8(_mm_castps_si128(cmp)));
+    }
+    else if constexpr (std::same_as<T, double>)
+    {
+        __m128d const block = _mm_loadu_pd(p);
+        __m128d const value = _mm_castsi128_pd(v);
+        __m128d const cmp   = Op == simd_cmp::lt   ? _mm_cmplt_pd(block, value)
+                              : Op == simd_cmp::le ? _mm_cmple_pd(block, value)
+                              : Op == simd_cmp::gt ? _mm_cmpgt_pd(block, value)
+                                                   : _mm_cmpge_pd(block, value);
+        return static_cast<simd_mask_t>(_mm_movemask_epi8(_mm_castpd_si128(cmp)));
+    }
+    else
+    {
+        simd_vec_t const block = _mm_loadu_si128(reinterpret_cast<simd_vec_t const *>(p));
+        if constexpr (Op == simd_cmp::lt)
+            return static_cast<simd_mask_t>(_mm_movemask_epi8(simd_cmpgt<T>(v, block)));
+        else if constexpr (Op == simd_cmp::le)
+            return static_cast<simd_mask_t>(_mm_movemask_epi8(simd_cmpgt<T>(block, v))) ^ simd_full_mask;
+        else if constexpr (Op == simd_cmp::gt)
+            return static_cast<simd_mask_t>(_mm_movemask_epi8(simd_cmpgt<T>(block, v)));
+        else
+            return static_cast<simd_mask_t>(_mm_movemask_epi8(simd_cmpgt<T>(v, block))) ^ simd_full_mask;
+    }
+}
+
+#elif defined(RADR_SIMD_NEON)
+
+inline constexpr bool        simd_available          = true;
+inline constexpr size_t      simd_width              = 16;
+inline constexpr size_t      simd_mask_bits_per_byte = 4;
+using simd_vec_t                                     = uint8x16_t;
+using simd_mask_t                                    = uint64_t;
+inline constexpr simd_mask_t simd_full_mask          = ~uint64_t{0};
+
+template <simd_comparable T>
+inline constexpr bool simd_cmp_available = true;
+
+template <simd_comparable T>
+inline simd_vec_t simd_broadcast(T const v) noexcept
+{
+    if constexpr (std::same_as<T, float>)
+        return vreinterpretq_u8_f32(vdupq_n_f32(v));
+    else if constexpr (std::same_as<T, double>)
+        return vreinterpretq_u8_f64(vdupq_n_f64(v));
+    else if constexpr (sizeof(T) == 1)
+        return vdupq_n_u8(static_cast<uint8_t>(v));
+    else if constexpr (sizeof(T) == 2)
+        return vreinterpretq_u8_u16(vdupq_n_u16(static_cast<uint16_t>(v)));
+    else if constexpr (sizeof(T) == 4)
+        return vreinterpretq_u8_u32(vdupq_n_u32(static_cast<uint32_t>(v)));
+    else
+        return vreinterpretq_u8_u64(vdupq_n_u64(static_cast<uint64_t>(v)));
+}
+
+template <simd_findable T>
+inline simd_mask_t simd_eq_mask(T const * const p, simd_vec_t const needle) noexcept
+{
+    simd_vec_t const block = vld1q_u8(reinterpret_cast<uint8_t const *>(p));
+    simd_vec_t       eq;
+    if constexpr (sizeof(T) == 1)
+        eq = vceqq_u8(block, needle);
+    else if constexpr (sizeof(T) == 2)
+        eq = vreinterpretq_u8_u16(vceqq_u16(vreinterpretq_u16_u8(block), vreinterpretq_u16_u8(needle)));
+    else if constexpr (sizeof(T) == 4)
+        eq = vreinterpretq_u8_u32(vceqq_u32(vreinterpretq_u32_u8(block), vreinterpretq_u32_u8(needle)));
+    else
+        eq = vreinterpretq_u8_u64(vceqq_u64(vreinterpretq_u64_u8(block), vreinterpretq_u64_u8(needle)));
+    // narrow every byte to 4 bits (there is no movemask on NEON)
+    return vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(eq), 4)), 0);
+}
+
+//!\brief Comparison `a > b` (or `a >= b` if OrEqual) of the elements of type T.
+template <bool OrEqual, simd_comparable T>
+inline simd_vec_t simd_cmpgt(simd_vec_t const a, simd_vec_t const b) noexcept
+{
+    if constexpr (std::same_as<T, float>)
+    {
+        float32x4_t const x = vreinterpretq_f32_u8(a);
+        float32x4_t const y = vreinterpretq_f32_u8(b);
+        return vreinterpretq_u8_u32(OrEqual ? vcgeq_f32(x, y) : vcgtq_f32(x, y));
+    }
+    else if constexpr (std::same_as<T, double>)
+    {
+        float64x2_t const x = vreinterpretq_f64_u8(a);
+        float64x2_t const y = vreinterpretq_f64_u8(b);
+        return vreinterpretq_u8_u64(OrEqual ? vcgeq_f64(x, y) : vcgtq_f64(x, y));
+    }
+    else if constexpr (sizeof(T) == 1 && std::is_signed_v<T>)
+    {
+        int8x16_t const x = vreinterpretq_s8_u8(a);
+        int8x16_t const y = vreinterpretq_s8_u8(b);
+        return OrEqual ? vcgeq_s8(x, y) : vcgtq_s8(x, y);
+    }
+    else if constexpr (sizeof(T) == 1)
+    {
+        return OrEqual ? vcgeq_u8(a, b) : vcgtq_u8(a, b);
+    }
+    else if constexpr (sizeof(T) == 2 && std::is_signed_v<T>)
+    {
+        int16x8_t const x = vreinterpretq_s16_u8(a);
+        int16x8_t const y = vreinterpretq_s16_u8(b);
+        return vreinterpretq_u8_u16(OrEqual ? vcgeq_s16(x, y) : vcgtq_s16(x, y));
+    }
+    else if constexpr (sizeof(T) == 2)
+    {
+        uint16x8_t const x = vreinterpretq_u16_u8(a);
+        uint16x8_t const y = vreinterpretq_u16_u8(b);
+        return vreinterpretq_u8_u16(OrEqual ? vcgeq_u16(x, y) : vcgtq_u16(x, y));
+    }
+    else if constexpr (sizeof(T) == 4 && std::is_signed_v<T>)
+    {
+        int32x4_t const x = vreinterpretq_s32_u8(a);
+        int32x4_t const y = vreinterpretq_s32_u8(b);
+        return vreinterpretq_u8_u32(OrEqual ? vcgeq_s32(x, y) : vcgtq_s32(x, y));
+    }
+    else if constexpr (sizeof(T) == 4)
+    {
+        uint32x4_t const x = vreinterpretq_u32_u8(a);
+        uint32x4_t const y = vreinterpretq_u32_u8(b);
+        return vreinterpretq_u8_u32(OrEqual ? vcgeq_u32(x, y) : vcgtq_u32(x, y));
+    }
+    else if constexpr (std::is_signed_v<T>)
+    {
+        int64x2_t const x = vreinterpretq_s64_u8(a);
+        int64x2_t const y = vreinterpretq_s64_u8(b);
+        return vreinterpretq_u8_u64(OrEqual ? vcgeq_s64(x, y) : vcgtq_s64(x, y));
+    }
+    else
+    {
+        uint64x2_t const x = vreinterpretq_u64_u8(a);
+        uint64x2_t const y = vreinterpretq_u64_u8(b);
+        return vreinterpretq_u8_u64(OrEqual ? vcgeq_u64(x, y) : vcgtq_u64(x, y));
+    }
+}
+
+template <simd_cmp Op, simd_comparable T>
+inline simd_mask_t simd_cmp_mask(T const * const p, simd_vec_t const v) noexcept
+{
+    simd_vec_t const block = vld1q_u8(reinterpret_cast<uint8_t const *>(p));
+    simd_vec_t       cmp;
+    if constexpr (Op == simd_cmp::lt)
+        cmp = simd_cmpgt<false, T>(v, block);
+    else if constexpr (Op == simd_cmp::le)
+        cmp = simd_cmpgt<true, T>(v, block);
+    else if constexpr (Op == simd_cmp::gt)
+        cmp = simd_cmpgt<false, T>(block, v);
+    else
+        cmp = simd_cmpgt<true, T>(block, v);
+    return vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(cmp), 4)), 0);
+}
+
+#else
+
+inline constexpr bool simd_available = false;
+
+#endif
+//!\}
+
+#if defined(RADR_SIMD_AVX2) || defined(RADR_SIMD_SSE2) || defined(RADR_SIMD_NEON)
+/*!\brief Skips the full vectors at the beginning of [b, e) where mask_fn() (or its complement if Negate) is zero.
+ * \returns A pointer to the first element whose bits are set, or to the remaining elements (fewer than a vector).
+ */
+template <bool Negate, typename T, typename MaskFn>
+inline T const * simd_skip(T const * b, T const * const e, MaskFn const & mask_fn) noexcept
+{
+    constexpr size_t n = simd_width / sizeof(T);
+    for (; static_cast<size_t>(e - b) >= n; b += n)
+    {
+        simd_mask_t const mask = Negate ? mask_fn(b) ^ simd_full_mask : mask_fn(b);
+        if (mask != 0)
+            return b + std::countr_zero(mask) / (simd_mask_bits_per_byte * sizeof(T));
+    }
+    return b;
+}
+
+//!\brief Whether simd_byte_set_mask() is available.
+#    if defined(RADR_SIMD_SHUFFLE)
+inline constexpr bool simd_has_shuffle = true;
+#    else
+inline constexpr bool simd_has_shuffle = false;
+#    endif
+
+#    if defined(RADR_SIMD_AVX2)
+//!\brief For every 8-bit mask, the positions of the set bits in 4-bit fields (used by radr::detail::simd_compress).
+inline constexpr std::array<uint32_t, 256> simd_compress_table = []()
+{
+    std::array<uint32_t, 256> table{};
+    for (uint32_t m = 0; m < 256; ++m)
+        for (uint32_t i = 0, k = 0; i < 8; ++i)
+            if ((m >> i) & 1u)
+                table[m] |= i << (4 * k++);
+    return table;
+}();
+#    endif
+
+/*!\brief Stores the elements of the vector at \p p whose bits are set in \p mask contiguously at \p out.
+ * \returns The number of elements stored.
+ * \details
+ *
+ * A full vector may be written to \p out, also if fewer elements are selected. With AVX2, elements of 4 or 8 bytes
+ * are moved by one permutation whose indices are looked up in a table. Other elements are moved one by one, but the
+ * output position is advanced without branches.
+ */
+template <simd_comparable T>
+inline size_t simd_compress(T const * const p, simd_mask_t const mask, T * const out) noexcept
+{
+#    if defined(RADR_SIMD_AVX2)
+    if constexpr (sizeof(T) >= 4)
+    {
+        uint32_t m = mask & 0x1111'1111u; // one bit per 4 bytes
+        m          = (m | (m >> 3)) & 0x0303'0303u;
+        m          = (m | (m >> 6)) & 0x000F'000Fu;
+        m          = (m | (m >> 12)) & 0xFFu;
+
+        __m256i const shifts = _mm256_setr_epi32(0, 4, 8, 12, 16, 20, 24, 28);
+        __m256i const fields = _mm256_set1_epi32(static_cast<int>(simd_compress_table[m]));
+        __m256i const idx    = _mm256_and_si256(_mm256_srlv_epi32(fields, shifts), _mm256_set1_epi32(7));
+        __m256i const block  = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(p));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(out), _mm256_permutevar8x32_epi32(block, idx));
+        return static_cast<size_t>(std::popcount(m)) * 4 / sizeof(T);
+    }
+#    endif
+
+    constexpr size_t n         = simd_width / sizeof(T);
+    constexpr size_t elem_bits = simd_mask_bits_per_byte * sizeof(T);
+
+    size_t k = 0;
+    for (size_t i = 0; i < n; ++i)
+    {
+        out[k] = p[i];
+        k += static_cast<size_t>((mask >> (i * elem_bits)) & 1u);
+    }
+    return k;
+}
+#endif
+
+//!\brief The number of bytes that radr::detail::simd_find checks one by one before calling std::memchr.
+inline constexpr ptrdiff_t simd_short_scan = 16;
+
+/*!\brief Returns a pointer to the first element in [b, e) that is equal to v, or e if there is none.
+ * \details
+ *
+ * Bytes are searched via std::memchr (which is vectorised in all common C libraries); other integral types are
+ * searched with SSE2, AVX2 or NEON (whatever is enabled at compile-time) and via std::find otherwise.
+ */
+template <simd_findable T>
+constexpr T const * simd_find(T const * b, T const * const e, T const v) noexcept
+{
+    if (!std::is_constant_evaluated())
+    {
+        if constexpr (sizeof(T) == 1)
+        {
+            // matches are often close; don't pay for the call in that case
+            for (T const * const short_e = b + std::min<ptrdiff_t>(e - b, simd_short_scan); b != short_e; ++b)
+                if (*b == v)
+                    return b;
+            if (b == e)
+                return e;
+            void const * const m = std::memchr(b, static_cast<unsigned char>(v), static_cast<size_t>(e - b));
+            return m == nullptr ? e : static_cast<T const *>(m);
+        }
+#if defined(RADR_SIMD_AVX2) || defined(RADR_SIMD_SSE2) || defined(RADR_SIMD_NEON)
+        else
+        {
+            constexpr size_t n      = simd_width / sizeof(T);
+            simd_vec_t const needle = simd_broadcast(v);
+            for (; static_cast<size_t>(e - b) >= n; b += n)
+                if (simd_mask_t const mask = simd_eq_mask(b, needle); mask != 0)
+                    return b + std::countr_zero(mask) / (simd_mask_bits_per_byte * sizeof(T));
+        }
+#endif
+    }
+
+    return std::find(b, e, v);
+}
+
+//!\brief Returns a pointer to the first element in [b, e) that is not equal to v, or e if there is none.
+template <simd_findable T>
+constexpr T const * simd_find_not(T const * b, T const * const e, T const v) noexcept
+{
+#if defined(RADR_SIMD_AVX2) || defined(RADR_SIMD_SSE2) || defined(RADR_SIMD_NEON)
+    if (!std::is_constant_evaluated())
+    {
+        simd_vec_t const needle = simd_broadcast(v);
+        b = simd_skip<true>(b, e, [needle](T const * const p) { return simd_eq_mask(p, needle); });
+    }
+#endif
+
+    return std::find_if(b, e, [v](T const x) { return x != v; });
+}
+
+/*!\brief Returns a pointer to the first element x in [b, e) for which `x Op v` holds (does not hold if Negate), or e.
+ * \details
+ *
+ * Vectors of elements are compared at once with SSE2, AVX2 or NEON (whatever is enabled at compile-time).
+ */
+template <simd_cmp Op, bool Negate, simd_comparable T>
+constexpr T const * simd_find_cmp(T const * b, T const * const e, T const v) noexcept
+{
+#if defined(RADR_SIMD_AVX2) || defined(RADR_SIMD_SSE2) || defined(RADR_SIMD_NEON)
+    if constexpr (simd_cmp_available<T>)
+    {
+        if (!std::is_constant_evaluated())
+        {
+            simd_vec_t const needle = simd_broadcast(v);
+            b = simd_skip<Negate>(b, e, [needle](T const * const p) { return simd_cmp_mask<Op>(p, needle); });
+        }
+    }
+#endif
+
+    return std::find_if(b, e, [v](T const x) { return simd_cmp_scalar<Op>(x, v) != Negate; });
+}
+
+//!\brief Like radr::detail::simd_find_cmp, but finds elements x with `lo <= x && x <= hi`.
+template <bool Negate, simd_comparable T>
+constexpr T const * simd_find_between(T const * b, T const * const e, T const lo, T const hi) noexcept
+{
+#if defined(RADR_SIMD_AVX2) || defined(RADR_SIMD_SSE2) || defined(RADR_SIMD_NEON)
+    if constexpr (simd_cmp_available<T>)
+    {
+        if (!std::is_constant_evaluated())
+        {
+            simd_vec_t const lo_v    = simd_broadcast(lo);
+            simd_vec_t const hi_v    = simd_broadcast(hi);
+            auto const       mask_fn = [lo_v, hi_v](T const * const p)
+            { return simd_cmp_mask<simd_cmp::ge>(p, lo_v) & simd_cmp_mask<simd_cmp::le>(p, hi_v); };
+            b = simd_skip<Negate>(b, e, mask_fn);
+        }
+    }
+#endif
+
+    return std::find_if(b, e, [lo, hi](T const x) { return (lo <= x && x <= hi) != Negate; });
+}
+
+/*!\brief Returns a pointer to the first element in [b, e) that is equal to one of the \p values (none if Negate), or e.
+ * \details
+ *
+ * Every vector is compared with every value; for bytes, radr::detail::simd_find_any is faster.
+ */
+template <bool Negate, simd_findable T, size_t N>
+constexpr T const * simd_find_any_of(T const * b, T const * const e, std::array<T, N> const & values) noexcept
+{
+#if defined(RADR_SIMD_AVX2) || defined(RADR_SIMD_SSE2) || defined(RADR_SIMD_NEON)
+    if constexpr (N > 0)
+    {
+        if (!std::is_constant_evaluated())
+        {
+            simd_vec_t needles[N];
+            for (size_t i = 0; i < N; ++i)
+                needles[i] = simd_broadcast(values[i]);
+
+            auto const mask_fn = [&needles](T const * const p)
+            {
+                simd_mask_t mask = 0;
+                for (size_t i = 0; i < N; ++i)
+                    mask |= simd_eq_mask(p, needles[i]);
+                return mask;
+            };
+            b = simd_skip<Negate>(b, e, mask_fn);
+        }
+    }
+#endif
+
+    auto const is_member = [&values](T const x) { return std::ranges::find(values, x) != values.end(); };
+    return std::find_if(b, e, [&is_member](T const x) { return is_member(x) != Negate; });
+}
+
+/*!\brief Returns a pointer to the first occurrence of [pb, pe) in [b, e), or e if there is none.
+ * \details
+ *
+ * Candidate positions are those where the first and the last element of the pattern match; with SIMD, these are
+ * determined for a full vector of positions at once (two comparisons and an `&`), and only the candidates are
+ * compared completely (via std::equal which calls std::memcmp). Without SIMD, candidates are found via
+ * radr::detail::simd_find on the first element.
+ *
+ * This needs no preprocessing of the pattern. The worst case is O(n·m), but for the short patterns typically used as
+ * delimiters, false candidates are rare and the search runs at the speed of the vector comparisons.
+ */
+template <simd_findable T>
+constexpr T const * simd_search(T const * b, T const * const e, T const * const pb, T const * const pe) noexcept
+{
+    size_t const m = static_cast<size_t>(pe - pb);
+    if (m == 0)
+        return b;
+    if (static_cast<size_t>(e - b) < m)
+        return e;
+    if (m == 1)
+        return simd_find(b, e, *pb);
+
+    T const * const last = e - (m - 1); // one past the last candidate position
+
+#if defined(RADR_SIMD_AVX2) || defined(RADR_SIMD_SSE2) || defined(RADR_SIMD_NEON)
+    if (!std::is_constant_evaluated())
+    {
+        constexpr size_t      n         = simd_width / sizeof(T);
+        constexpr size_t      elem_bits = simd_mask_bits_per_byte * sizeof(T);
+        constexpr simd_mask_t elem_mask = static_cast<simd_mask_t>((uint64_t{1} << elem_bits) - 1);
+
+        simd_vec_t const first_v = simd_broadcast(pb[0]);
+        simd_vec_t const last_v  = simd_broadcast(pb[m - 1]);
+        for (; static_cast<size_t>(last - b) >= n; b += n)
+        {
+            simd_mask_t mask = simd_eq_mask(b, first_v) & simd_eq_mask(b + m - 1, last_v);
+            while (mask != 0)
+            {
+                size_t const i = static_cast<size_t>(std::countr_zero(mask)) / elem_bits;
+                if (std::equal(pb + 1, pe - 1, b + i + 1))
+                    return b + i;
+                mask &= ~(elem_mask << (i * elem_bits));
+            }
+        }
+    }
+#endif
+
+    for (; (b = simd_find(b, last, pb[0])) != last; ++b)
+        if (std::equal(pb + 1, pe, b + 1))
+            return b;
+    return e;
+}
+
+/*!\brief A set of bytes (256 bits), stored as nibble tables.
+ * \details
+ *
+ * Bit `h` of `table[n]` is set iff the byte `h << 4 | n` is a member (for h < 8); `table[16 + n]` is the same for the
+ * bytes with h >= 8. This layout allows looking up 16 or 32 bytes at once via byte shuffles (PSHUFB / TBL): the table
+ * indexed by the low nibble is combined with a table indexed by the high nibble that selects the bit.
+ */
+struct byte_set
+{
+    std::array<uint8_t, 32> table{};
+    std::array<uint8_t, 8>  members{};   // the first members (used if there is no byte shuffle instruction)
+    uint8_t                 n_members{}; // the number of members; saturates at members.size() + 1
+
+    //!\brief The bit that selects the high nibble (for bytes < 128).
+    static constexpr std::array<uint8_t, 16> hi_bits{1, 2, 4, 8, 16, 32, 64, 128, 0, 0, 0, 0, 0, 0, 0, 0};
+    //!\brief The bit that selects the high nibble (for bytes >= 128).
+    static constexpr std::array<uint8_t, 16> hi_high_bits{0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 4, 8, 16, 32, 64, 128};
+
+    constexpr void insert(uint8_t const c) noexcept
+    {
+        if (contains(c))
+            return;
+        if (n_members < members.size())
+            members[n_members] = c;
+        if (n_members <= members.size())
+            ++n_members;
+        table[(c & 15) | ((c >> 3) & 16)] |= static_cast<uint8_t>(1u << ((c >> 4) & 7));
+    }
+
+    constexpr bool contains(uint8_t const c) const noexcept
+    {
+        return (table[(c & 15) | ((c >> 3) & 16)] >> ((c >> 4) & 7)) & 1u;
+    }
+
+    friend constexpr bool operator==(byte_set const &, byte_set const &) = default;
+};
+
+/*!\name Byte set lookup
+ * \brief simd_byte_set_mask() returns a mask as simd_eq_mask() for the bytes in [p, p + simd_width) that are members.
+ * \{
+ */
+#if defined(RADR_SIMD_AVX2)
+
+struct simd_byte_set_t
+{
+    simd_vec_t lo, lo_high, hi, hi_high;
+};
+
+inline simd_byte_set_t simd_byte_set(byte_set const & set) noexcept
+{
+    auto load = [](uint8_t const * t)
+    { return _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<__m128i const *>(t))); };
+    return {load(set.table.data()),
+            load(set.table.data() + 16),
+            load(byte_set::hi_bits.data()),
+            load(byte_set::hi_high_bits.data())};
+}
+
+inline simd_mask_t simd_byte_set_mask(uint8_t const * const p, simd_byte_set_t const & set) noexcept
+{
+    simd_vec_t const block = _mm256_loadu_si256(reinterpret_cast<simd_vec_t const *>(p));
+    simd_vec_t const nib   = _mm256_set1_epi8(0x0f);
+    simd_vec_t const lo_n  = _mm256_and_si256(block, nib);
+    simd_vec_t const hi_n  = _mm256_and_si256(_mm256_srli_epi16(block, 4), nib);
+    simd_vec_t const bits  = _mm256_or_si256(
+      _mm256_and_si256(_mm256_shuffle_epi8(set.lo, lo_n), _mm256_shuffle_epi8(set.hi, hi_n)),
+      _mm256_and_si256(_mm256_shuffle_epi8(set.lo_high, lo_n), _mm256_shuffle_epi8(set.hi_high, hi_n)));
+    return ~static_cast<simd_mask_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(bits, _mm256_setzero_si256())));
+}
+
+#elif defined(RADR_SIMD_SSE2) && defined(RADR_SIMD_SHUFFLE)
+
+struct simd_byte_set_t
+{
+    simd_vec_t lo, lo_high, hi, hi_high;
+};
+
+inline simd_byte_set_t simd_byte_set(byte_set const & set) noexcept
+{
+    auto load = [](uint8_t const * t) { return _mm_loadu_si128(reinterpret_cast<simd_vec_t const *>(t)); };
+    return {load(set.table.data()),
+            load(set.table.data() + 16),
+            load(byte_set::hi_bits.data()),
+            load(byte_set::hi_high_bits.data())};
+}
+
+inline simd_mask_t simd_byte_set_mask(uint8_t const * const p, simd_byte_set_t const & set) noexcept
+{
+    simd_vec_t const block = _mm_loadu_si128(reinterpret_cast<simd_vec_t const *>(p));
+    simd_vec_t const nib   = _mm_set1_epi8(0x0f);
+    simd_vec_t const lo_n  = _mm_and_si128(block, nib);
+    simd_vec_t const hi_n  = _mm_and_si128(_mm_srli_epi16(block, 4), nib);
+    simd_vec_t const bits  = _mm_or_si128(_mm_and_si128(_mm_shuffle_epi8(set.lo, lo_n), _mm_shuffle_epi8(set.hi, hi_n)),
+                                         _mm_and_si128(_mm_shuffle_epi8(set.lo_high, lo_n),
+                                                       _mm_shuffle_epi8(set.hi_high, hi_n)));
+    return static_cast<simd_mask_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(bits, _mm_setzero_si128()))) ^ 0xFFFFu;
+}
+
+#elif defined(RADR_SIMD_NEON)
+
+struct simd_byte_set_t
+{
+    simd_vec_t lo, lo_high, hi, hi_high;
+};
+
+inline simd_byte_set_t simd_byte_set(byte_set const & set) noexcept
+{
+    return {vld1q_u8(set.table.data()),
+            vld1q_u8(set.table.data() + 16),
+            vld1q_u8(byte_set::hi_bits.data()),
+            vld1q_u8(byte_set::hi_high_bits.data())};
+}
+
+inline simd_mask_t simd_byte_set_mask(uint8_t const * const p, simd_byte_set_t const & set) noexcept
+{
+    simd_vec_t const block = vld1q_u8(p);
+    simd_vec_t const lo_n  = vandq_u8(block, vdupq_n_u8(0x0f));
+    simd_vec_t const hi_n  = vshrq_n_u8(block, 4);
+    simd_vec_t const bits  = vorrq_u8(vandq_u8(vqtbl1q_u8(set.lo, lo_n), vqtbl1q_u8(set.hi, hi_n)),
+                                     vandq_u8(vqtbl1q_u8(set.lo_high, lo_n), vqtbl1q_u8(set.hi_high, hi_n)));
+    return vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(vtstq_u8(bits, bits)), 4)), 0);
+}
+
+#endif
+//!\}
+
+/*!\brief Returns a pointer to the first byte in [b, e) that is a member of \p set (not a member if Negate), or e.
+ * \details
+ *
+ * Uses byte shuffles (SSSE3, AVX2 or NEON, whatever is enabled at compile-time) to classify a vector of bytes at
+ * once. With only SSE2, a vector of bytes is compared with every member, if there are
+ * at most eight. Otherwise, the table is looked up per byte.
+ */
+template <bool Negate = false, byte_like T>
+constexpr T const * simd_find_any(T const * b, T const * const e, byte_set const & set) noexcept
+{
+#if defined(RADR_SIMD_SHUFFLE)
+    if (!std::is_constant_evaluated())
+    {
+        simd_byte_set_t const vset = simd_byte_set(set);
+        for (; static_cast<size_t>(e - b) >= simd_width; b += simd_width)
+        {
+            simd_mask_t mask = simd_byte_set_mask(reinterpret_cast<uint8_t const *>(b), vset);
+            if constexpr (Negate)
+                mask ^= simd_full_mask;
+            if (mask != 0)
+                return b + std::countr_zero(mask) / simd_mask_bits_per_byte;
+        }
+    }
+#elif defined(RADR_SIMD_SSE2)
+    // no byte shuffle; compare with every member if there are few
+    if (!std::is_constant_evaluated() && set.n_members <= set.members.size())
+    {
+        simd_vec_t needles[8];
+        for (size_t i = 0; i < set.n_members; ++i)
+            needles[i] = simd_broadcast(static_cast<T>(set.members[i]));
+
+        for (; static_cast<size_t>(e - b) >= simd_width; b += simd_width)
+        {
+            simd_mask_t mask = 0;
+            for (size_t i = 0; i < set.n_members; ++i)
+                mask |= simd_eq_mask(b, needles[i]);
+            if constexpr (Negate)
+                mask ^= simd_full_mask;
+            if (mask != 0)
+                return b + std::countr_zero(mask) / simd_mask_bits_per_byte;
+        }
+    }
+#endif
+
+    for (; b != e; ++b)
+        if (set.contains(static_cast<uint8_t>(*b)) != Negate)
+            return b;
+    return e;
+}
+
+} // namespace radr::detail
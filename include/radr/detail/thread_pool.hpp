@@ -0,0 +1,172 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Copyright (c) 2023-2025 Hannes Hauswedell
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See the LICENSE file for details.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace radr::detail
+{
+
+//!\brief The number of threads to use if the user passes 0.
+inline std::size_t default_thread_count() noexcept
+{
+    return std::max<std::size_t>(1, std::thread::hardware_concurrency());
+}
+
+/*!\brief A fixed set of worker threads that run one job on submitted indexes.
+ * \details
+ *
+ * The job is set on construction, so submitting work only enqueues an index (no allocation of a task object). The job
+ * must not throw. Pending indexes are discarded on destruction; jobs that are already running are waited for.
+ */
+class thread_pool
+{
+    std::function<void(std::size_t)> job;
+    std::mutex                       mtx;
+    std::condition_variable          cv;
+    std::deque<std::size_t>          queue;
+    bool                             stop = false;
+    std::vector<std::thread>         threads;
+
+    void work()
+    {
+        while (true)
+        {
+            std::size_t i = 0;
+            {
+                std::unique_lock lock{mtx};
+                cv.wait(lock, [this] { return stop || !queue.empty(); });
+                if (stop)
+                    return;
+                i = queue.front();
+                queue.pop_front();
+            }
+            job(i);
+        }
+    }
+
+public:
+    thread_pool(std::size_t const n_threads, std::function<void(std::size_t)> job_) : job{std::move(job_)}
+    {
+        threads.reserve(n_threads);
+        for (std::size_t t = 0; t < n_threads; ++t)
+            threads.emplace_back([this] { work(); });
+    }
+
+    thread_pool(thread_pool const &)             = delete;
+    thread_pool & operator=(thread_pool const &) = delete;
+
+    ~thread_pool()
+    {
+        {
+            std::lock_guard lock{mtx};
+            stop = true;
+        }
+        cv.notify_all();
+        for (std::thread & t : threads)
+            t.join();
+    }
+
+    std::size_t size() const noexcept { return threads.size(); }
+
+    void submit(std::size_t const i)
+    {
+        {
+            std::lock_guard lock{mtx};
+            queue.push_back(i);
+        }
+        cv.notify_one();
+    }
+};
+
+/*!\brief Worker threads that run arbitrary tasks; used by radr::detail::par_run.
+ * \details
+ *
+ * Threads are only created by reserve() and live until the pool is destroyed, so they are reused across calls. Tasks
+ * must not throw. Pending tasks are discarded on destruction; tasks that are already running are waited for.
+ */
+class task_pool
+{
+    std::mutex                        mtx;
+    std::condition_variable           cv;
+    std::deque<std::function<void()>> queue;
+    bool                              stop = false;
+    std::vector<std::thread>          threads;
+
+    void work()
+    {
+        while (true)
+        {
+            std::function<void()> task;
+            {
+                std::unique_lock lock{mtx};
+                cv.wait(lock, [this] { return stop || !queue.empty(); });
+                if (stop)
+                    return;
+                task = std::move(queue.front());
+                queue.pop_front();
+            }
+            task();
+        }
+    }
+
+public:
+    task_pool() = default;
+
+    task_pool(task_pool const &)             = delete;
+    task_pool & operator=(task_pool const &) = delete;
+
+    ~task_pool()
+    {
+        {
+            std::lock_guard lock{mtx};
+            stop = true;
+        }
+        cv.notify_all();
+        for (std::thread & t : threads)
+            t.join();
+    }
+
+    //!\brief Creates threads until there are at least \p n_threads.
+    void reserve(std::size_t const n_threads)
+    {
+        std::lock_guard lock{mtx};
+        while (threads.size() < n_threads)
+            threads.emplace_back([this] { work(); });
+    }
+
+    void submit(std::function<void()> task)
+    {
+        {
+            std::lock_guard lock{mtx};
+            queue.push_back(std::move(task));
+        }
+        cv.notify_one();
+    }
+};
+
+//!\brief The process-wide radr::detail::task_pool (created on first use).
+inline task_pool & shared_task_pool()
+{
+    static task_pool pool;
+    return pool;
+}
+
+} // namespace radr::detail
@@ -13,6 +13,7 @@
 
 #include <iterator>
 
+#include "../frame_resource.hpp"
 #include "../rad/take.hpp"
 
 namespace radr
@@ -70,7 +71,8 @@ inline constexpr auto counted_sp = []<typename It>(It && it, size_t const n)
                   "You must pass an iterator as first argument to radr::counted_sp().");
 
     // Intentionally, no forwarding reference in this signature
-    return [](It it, size_t const n) -> generator<std::iter_reference_t<It>, std::iter_value_t<It>>
+    return [](std::allocator_arg_t, detail::frame_allocator_t, It it, size_t const n)
+             -> generator<std::iter_reference_t<It>, std::iter_value_t<It>>
     {
         uint64_t i = 0;
         while (i < n)
@@ -79,7 +81,7 @@ inline constexpr auto counted_sp = []<typename It>(It && it, size_t const n)
             ++i;
             ++it;
         }
-    }(std::forward<It>(it), n);
+    }(std::allocator_arg, detail::frame_allocator(), std::forward<It>(it), n);
 };
 
 } // namespace cpo
@@ -17,6 +17,7 @@
 
 #include "radr/concepts.hpp"
 #include "radr/detail/fwd.hpp"
+#include "radr/frame_resource.hpp"
 #include "radr/generator.hpp"
 #include "radr/rad_util/borrowing_rad.hpp"
 
@@ -315,18 +316,21 @@ inline constexpr detail::iota_fn iota{};
  * The requirements on the types are weaker than for radr::iota.
  */
 inline constexpr auto iota_sp =
-  []<typename Value, typename Bound = std::unreachable_sentinel_t>(Value val, Bound bound = {})->radr::generator<Value>
+  []<typename Value, typename Bound = std::unreachable_sentinel_t>(Value val, Bound bound = {})
 {
     static_assert(std::weakly_incrementable<Value>,
                   "The Value type to radr::iota_sp needs to satisfy std::weakly_incrementable.");
     static_assert(detail::weakly_equality_comparable_with<Value, Bound>,
                   "The Value type to radr::iota_sp needs to be comparable with the Bound type.");
 
-    while (val != bound)
+    return [](std::allocator_arg_t, detail::frame_allocator_t, Value val_, Bound bound_) -> radr::generator<Value>
     {
-        co_yield val;
-        ++val;
-    }
+        while (val_ != bound_)
+        {
+            co_yield val_;
+            ++val_;
+        }
+    }(std::allocator_arg, detail::frame_allocator(), std::move(val), std::move(bound));
 };
 
 } // namespace radr
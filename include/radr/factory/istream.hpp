@@ -13,6 +13,7 @@
 
 #include <istream>
 
+#include "radr/frame_resource.hpp"
 #include "radr/generator.hpp"
 
 namespace radr::detail
@@ -21,8 +22,21 @@ namespace radr::detail
 template <class Val, class CharT, class Traits>
 concept stream_extractable = requires(std::basic_istream<CharT, Traits> & is, Val & t) { is >> t; };
 
+template <typename Val, class CharT, class Traits>
+generator<Val &, Val> istream_coro(std::allocator_arg_t, frame_allocator_t, std::basic_istream<CharT, Traits> & stream)
+{
+    Val value;
+    stream >> value;
+
+    while (stream)
+    {
+        co_yield value;
+        stream >> value;
+    }
 }
 
+} // namespace radr::detail
+
 namespace radr
 {
 
@@ -45,14 +59,7 @@ generator<Val &, Val> istream(std::basic_istream<CharT, Traits> & stream)
     static_assert(detail::stream_extractable<Val, CharT, Traits>,
                   "The Val type cannot be extracted from the stream passed to radr::istream.");
 
-    Val value;
-    stream >> value;
-
-    while (stream)
-    {
-        co_yield value;
-        stream >> value;
-    }
+    return detail::istream_coro<Val>(std::allocator_arg, detail::frame_allocator(), stream);
 }
 
 } // namespace radr
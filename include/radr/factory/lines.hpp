@@ -0,0 +1,126 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Copyright (c) 2023-2025 Hannes Hauswedell
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See the LICENSE file for details.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include <cstring>
+#include <istream>
+#include <string_view>
+
+#include "../detail/block_reader.hpp"
+#include "../frame_resource.hpp"
+#include "../generator.hpp"
+
+namespace radr::detail
+{
+
+template <typename Reader, typename OnDone>
+generator<std::string_view, std::string_view> lines_coro(std::allocator_arg_t,
+                                                         frame_allocator_t,
+                                                         Reader reader,
+                                                         OnDone on_done)
+{
+    char const * it = reader.begin();
+    char const * e  = reader.end();
+
+    while (true)
+    {
+        /* find the end of the line; it might be in the next block */
+        std::size_t  offset = 0;
+        char const * nl     = nullptr;
+        while (true)
+        {
+            std::size_t const avail = static_cast<std::size_t>(e - it) - offset;
+            if (avail > 0)
+            {
+                nl = static_cast<char const *>(std::memchr(it + offset, '\n', avail));
+                if (nl != nullptr)
+                    break;
+            }
+
+            offset = static_cast<std::size_t>(e - it);
+            if (!reader.refill(it, e))
+                break;
+        }
+
+        if (nl == nullptr) // end of input
+        {
+            if (it != e) // last line without trailing newline
+                co_yield std::string_view{it, e};
+            on_done();
+            co_return;
+        }
+
+        co_yield std::string_view{it, nl};
+        it = nl + 1;
+    }
+}
+
+} // namespace radr::detail
+
+namespace radr
+{
+
+/*!\brief A range factory that produces the lines of an istream.
+ * \tparam Traits The character traits of the stream.
+ * \param[in,out] stream The stream to read from.
+ * \details
+ *
+ * The stream's buffer is read in large blocks, and the lines are found via `memchr`. Every line is returned as a
+ * std::string_view into the internal buffer, i.e. no characters are copied (unless a line spans two blocks).
+ * A string_view is only valid until the iterator is incremented.
+ *
+ * Lines are separated by `'\n'` which is not part of the returned lines (like with std::getline()); in particular, a
+ * trailing `'\r'` is not removed. If the input ends with `'\n'`, no empty line is returned after it.
+ *
+ * After the range is exhausted, the stream's eofbit and failbit are set (like after a loop of std::getline()).
+ * Characters are read from the stream in blocks, i.e. the stream's position is unspecified before that.
+ *
+ * The returned range is a specialisation of radr::generator, i.e. it is always a move-only, single-pass range.
+ *
+ * ```cpp
+ * std::ifstream file{"huge.log"};
+ * for (std::string_view line : radr::lines(file))
+ *     ...;
+ * ```
+ */
+template <class Traits>
+generator<std::string_view, std::string_view> lines(std::basic_istream<char, Traits> & stream)
+{
+    auto on_done = [&stream]()
+    {
+        stream.setstate(std::ios_base::eofbit | std::ios_base::failbit);
+    };
+
+    return detail::lines_coro(std::allocator_arg,
+                              detail::frame_allocator(),
+                              detail::block_reader{detail::streambuf_read_fn<Traits>{stream.rdbuf()}},
+                              on_done);
+}
+
+#if __has_include(<unistd.h>)
+/*!\brief A range factory that produces the lines read from a POSIX file descriptor.
+ * \param fd The file descriptor to read from; it is not closed.
+ * \throws std::system_error on read errors (when the iterator is incremented).
+ * \details
+ *
+ * Same as above, but reads directly via `::read()`. This can be used with pipes and sockets.
+ */
+inline generator<std::string_view, std::string_view> lines(int const fd)
+{
+    return detail::lines_coro(std::allocator_arg,
+                              detail::frame_allocator(),
+                              detail::block_reader{detail::fd_read_fn{fd}},
+                              []() {});
+}
+#endif
+
+} // namespace radr
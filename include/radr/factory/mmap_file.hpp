@@ -0,0 +1,210 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Copyright (c) 2023-2025 Hannes Hauswedell
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See the LICENSE file for details.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include <cerrno>
+#include <cstddef>
+#include <filesystem>
+#include <memory>
+#include <system_error>
+
+#if __has_include(<sys/mman.h>) && __has_include(<sys/stat.h>) && __has_include(<fcntl.h>) && \
+  __has_include(<unistd.h>)
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#    define RADR_HAS_MMAP 1
+#else
+#    include <fstream>
+#    define RADR_HAS_MMAP 0
+#endif
+
+#include "../custom/stable_iterators.hpp"
+#include "../rad_util/borrowing_rad.hpp"
+#include "../rad_util/owning_rad.hpp"
+
+namespace radr
+{
+
+//!\brief Access pattern hints for radr::mmap_file (see `madvise()`).
+enum class mmap_advice
+{
+    normal,     //!< No hint.
+    sequential, //!< MADV_SEQUENTIAL: aggressive read-ahead, pages can be freed soon after access.
+    random,     //!< MADV_RANDOM: no read-ahead.
+    willneed    //!< MADV_WILLNEED: start reading the whole file into memory now.
+};
+
+/*!\brief A read-only, memory-mapped file.
+ * \details
+ *
+ * This is a contiguous range of `char const` over the contents of the file. Copies share the mapping, i.e. copying
+ * is O(1) and the iterators (pointers) remain valid as long as one copy exists. The mapping is private and
+ * read-only; changes made to the file by other processes after the mapping was created may or may not be visible.
+ *
+ * Objects of this type are typically created via radr::mmap_file.
+ *
+ * On platforms without `<sys/mman.h>`, the file is read into memory instead (and the advice is ignored).
+ */
+class mapped_file
+{
+    struct mapping
+    {
+        char const * data = nullptr;
+        std::size_t  size = 0;
+
+        mapping()                            = default;
+        mapping(mapping const &)             = delete;
+        mapping & operator=(mapping const &) = delete;
+
+        ~mapping()
+        {
+#if RADR_HAS_MMAP
+            if (data != nullptr)
+                ::munmap(const_cast<char *>(data), size);
+#else
+            delete[] data;
+#endif
+        }
+    };
+
+    std::shared_ptr<mapping const> map_;
+
+    [[noreturn]] static void throw_error(char const * what, std::filesystem::path const & path)
+    {
+        throw std::filesystem::filesystem_error{what, path, std::error_code{errno, std::system_category()}};
+    }
+
+public:
+    mapped_file()                                = default;
+    mapped_file(mapped_file const &)             = default;
+    mapped_file(mapped_file &&)                  = default;
+    mapped_file & operator=(mapped_file const &) = default;
+    mapped_file & operator=(mapped_file &&)      = default;
+
+    /*!\brief Map the file at \p path.
+     * \throws std::filesystem::filesystem_error if the file cannot be opened or mapped.
+     */
+    explicit mapped_file(std::filesystem::path const & path, mmap_advice const advice = mmap_advice::normal)
+    {
+        auto map = std::make_shared<mapping>();
+
+#if RADR_HAS_MMAP
+        int const fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd == -1)
+            throw_error("radr::mmap_file: could not open file", path);
+
+        struct ::stat st{};
+        if (::fstat(fd, &st) == -1)
+        {
+            int const err = errno;
+            ::close(fd);
+            errno = err;
+            throw_error("radr::mmap_file: could not stat file", path);
+        }
+
+        /* mapping an empty file is not possible (and not necessary) */
+        if (st.st_size > 0)
+        {
+            std::size_t const size = static_cast<std::size_t>(st.st_size);
+            void *            ptr  = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (ptr == MAP_FAILED)
+            {
+                int const err = errno;
+                ::close(fd);
+                errno = err;
+                throw_error("radr::mmap_file: could not map file", path);
+            }
+
+            map->data = static_cast<char const *>(ptr);
+            map->size = size;
+
+            /* hints; failure is not an error */
+            switch (advice)
+            {
+                case mmap_advice::sequential:
+                    ::madvise(ptr, size, MADV_SEQUENTIAL);
+                    break;
+                case mmap_advice::random:
+                    ::madvise(ptr, size, MADV_RANDOM);
+                    break;
+                case mmap_advice::willneed:
+                    ::madvise(ptr, size, MADV_WILLNEED);
+                    break;
+                case mmap_advice::normal:
+                    break;
+            }
+        }
+
+        ::close(fd);
+#else
+        (void)advice;
+        std::ifstream stream{path, std::ios::binary | std::ios::ate};
+        if (!stream)
+            throw_error("radr::mmap_file: could not open file", path);
+
+        std::size_t const size = static_cast<std::size_t>(stream.tellg());
+        if (size > 0)
+        {
+            char * buffer = new char[size];
+            map->data     = buffer;
+            map->size     = size;
+            stream.seekg(0);
+            if (!stream.read(buffer, static_cast<std::streamsize>(size)))
+                throw_error("radr::mmap_file: could not read file", path);
+        }
+#endif
+
+        map_ = std::move(map);
+    }
+
+    char const * begin() const noexcept { return map_ ? map_->data : nullptr; }
+    char const * end() const noexcept { return map_ ? map_->data + map_->size : nullptr; }
+    char const * data() const noexcept { return begin(); }
+    std::size_t  size() const noexcept { return map_ ? map_->size : 0; }
+    bool         empty() const noexcept { return size() == 0; }
+
+    friend bool operator==(mapped_file const & lhs, mapped_file const & rhs) noexcept
+    {
+        return lhs.map_ == rhs.map_;
+    }
+};
+
+//!\brief The iterators of radr::mapped_file point into the mapping, which is not affected by moves.
+template <>
+inline constexpr bool custom::stable_iterators_on_move<mapped_file> = true;
+
+/*!\brief A range factory that maps a file into memory and returns a range over its contents.
+ * \param path The path of the file.
+ * \param advice A hint on how the file will be accessed, see radr::mmap_advice.
+ * \throws std::filesystem::filesystem_error if the file cannot be opened or mapped.
+ * \details
+ *
+ * The returned range is a radr::owning_rad over a radr::mapped_file. It is a contiguous, sized, common range of
+ * `char const` whose iterators are pointers. In contrast to radr::istream, this range is multi-pass, so all
+ * multi-pass adaptors can be applied and no data is copied:
+ *
+ * ```cpp
+ * auto lines = radr::mmap_file("huge.log", radr::mmap_advice::sequential) | radr::split('\n');
+ * for (auto line : lines) // contiguous ranges of char const (pointer pairs)
+ *     std::string_view{line.begin(), line.end()};
+ * ```
+ *
+ * The mapping is shared between copies of the returned range and unmapped when the last copy is destroyed.
+ */
+inline auto mmap_file(std::filesystem::path const & path, mmap_advice const advice = mmap_advice::normal)
+{
+    return owning_rad{mapped_file{path, advice}};
+}
+
+} // namespace radr
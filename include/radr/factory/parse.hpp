@@ -0,0 +1,225 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Copyright (c) 2023-2025 Hannes Hauswedell
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See the LICENSE file for details.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include <algorithm>
+#include <cerrno>
+#include <charconv>
+#include <concepts>
+#include <cstdlib>
+#include <istream>
+#include <ranges>
+#include <string>
+#include <system_error>
+
+#include "../concepts.hpp"
+#include "../detail/block_reader.hpp"
+#include "../detail/detail.hpp"
+#include "../frame_resource.hpp"
+#include "../generator.hpp"
+#include "../range_access.hpp"
+
+namespace radr::detail
+{
+
+template <typename Val>
+concept parsable_number =
+  std::same_as<Val, std::remove_cvref_t<Val>> &&
+  ((std::integral<Val> && !one_of<Val, bool, char, signed char, unsigned char, wchar_t, char8_t, char16_t, char32_t>) ||
+   std::floating_point<Val>);
+
+//!\brief Same characters as std::isspace() in the "C" locale.
+constexpr bool parse_is_space(char const c) noexcept
+{
+    return c == ' ' || (c >= '\t' && c <= '\r');
+}
+
+/*!\brief Parse a number from [b, e) via std::from_chars (or strtod if from_chars doesn't support floats).
+ * \details
+ *
+ * A leading '+' is accepted (like formatted stream extraction does).
+ */
+template <parsable_number Val>
+std::from_chars_result parse_number(char const * b, char const * const e, Val & val)
+{
+    if (e - b > 1 && *b == '+' && *(b + 1) != '-' && *(b + 1) != '+')
+        ++b;
+
+#ifndef __cpp_lib_to_chars // from_chars for floating point types is not available
+    if constexpr (std::floating_point<Val>)
+    {
+        std::string tmp{b, e}; // strto* needs a null-terminated string
+        char *      end = nullptr;
+        errno           = 0;
+
+        if constexpr (std::same_as<Val, float>)
+            val = std::strtof(tmp.c_str(), &end);
+        else if constexpr (std::same_as<Val, double>)
+            val = std::strtod(tmp.c_str(), &end);
+        else
+            val = std::strtold(tmp.c_str(), &end);
+
+        std::from_chars_result res{b + (end - tmp.c_str()), std::errc{}};
+        if (end == tmp.c_str())
+            res = {b, std::errc::invalid_argument};
+        else if (errno == ERANGE)
+            res.ec = std::errc::result_out_of_range;
+        return res;
+    }
+    else
+#endif
+    {
+        return std::from_chars(b, e, val);
+    }
+}
+
+//!\brief Input for radr::detail::parse_coro that is a contiguous range of chars.
+template <typename Range>
+struct parse_range_source
+{
+    [[no_unique_address]] Range range;
+
+    char const * begin() { return std::ranges::data(range); }
+    char const * end() { return std::ranges::data(range) + std::ranges::size(range); }
+
+    bool refill(char const *&, char const *&) { return false; }
+
+    void on_done(bool) {}
+};
+
+//!\brief Input for radr::detail::parse_coro that reads blocks from an istream's streambuf.
+template <typename Traits>
+struct parse_stream_source : block_reader<streambuf_read_fn<Traits>>
+{
+    std::basic_istream<char, Traits> * stream = nullptr;
+
+    explicit parse_stream_source(std::basic_istream<char, Traits> & stream_) :
+      block_reader<streambuf_read_fn<Traits>>{streambuf_read_fn<Traits>{stream_.rdbuf()}}, stream{&stream_}
+    {}
+
+    void on_done(bool const parse_error)
+    {
+        // same state as after a loop of formatted extractions
+        stream->setstate(parse_error ? std::ios_base::failbit : std::ios_base::eofbit | std::ios_base::failbit);
+    }
+};
+
+template <typename Val, typename Source>
+generator<Val &, Val> parse_coro(std::allocator_arg_t, frame_allocator_t, Source source)
+{
+    Val          value{};
+    char const * it = source.begin();
+    char const * e  = source.end();
+
+    while (true)
+    {
+        /* skip whitespace */
+        while (true)
+        {
+            it = std::find_if_not(it, e, parse_is_space);
+            if (it != e)
+                break;
+            if (!source.refill(it, e))
+            {
+                source.on_done(false);
+                co_return;
+            }
+        }
+
+        /* find the end of the token; it might be in the next block */
+        char const * tok_e = std::find_if(it, e, parse_is_space);
+        while (tok_e == e)
+        {
+            std::ptrdiff_t const offset = tok_e - it;
+            bool const           more   = source.refill(it, e); // invalidates tok_e
+            tok_e                       = std::find_if(it + offset, e, parse_is_space);
+            if (!more)
+                break;
+        }
+
+        auto [ptr, ec] = parse_number(it, tok_e, value);
+        if (ec != std::errc{})
+        {
+            source.on_done(true);
+            co_return;
+        }
+
+        it = ptr;
+        co_yield value;
+    }
+}
+
+} // namespace radr::detail
+
+namespace radr
+{
+
+/*!\brief A range factory that parses whitespace-separated numbers from a stream.
+ * \tparam Val The arithmetic type to parse.
+ * \param[in,out] stream The stream to parse from.
+ * \details
+ *
+ * This is a faster alternative to `radr::istream<Val>(stream)` for integral and floating point types.
+ * Instead of formatted extraction (`stream >> value`), it reads large blocks from the stream's buffer, skips
+ * whitespace and parses the numbers with std::from_chars.
+ * Parsing stops at the end of input or at the first token that does not start with a number (like formatted
+ * extraction would, the stream's failbit is set in both cases).
+ *
+ * Differences to radr::istream:
+ *   * The stream's locale is ignored. Numbers are parsed as in the "C" locale, and whitespace is `[ \t\n\v\f\r]`.
+ *   * Hexadecimal/octal prefixes are not recognised, and negative numbers are not accepted for unsigned types.
+ *   * Characters are read from the stream in blocks, i.e. the stream's position after parsing is unspecified.
+ *
+ * The returned range is a specialisation of radr::generator, i.e. it is always a move-only, single-pass range.
+ *
+ * ```cpp
+ * std::ifstream file{"numbers.txt"};
+ * for (int i : radr::parse<int>(file))
+ *     ...;
+ * ```
+ */
+template <typename Val, class Traits>
+generator<Val &, Val> parse(std::basic_istream<char, Traits> & stream)
+{
+    static_assert(detail::parsable_number<Val>,
+                  "radr::parse only supports integral types (that are not character types) and floating point types.");
+
+    return detail::parse_coro<Val>(std::allocator_arg,
+                                   detail::frame_allocator(),
+                                   detail::parse_stream_source<Traits>{stream});
+}
+
+/*!\brief A range factory that parses whitespace-separated numbers from a buffer.
+ * \tparam Val The arithmetic type to parse.
+ * \param[in] range A contiguous range of `char`, e.g. a std::string_view or the result of radr::mmap_file.
+ * \details
+ *
+ * See above. No copies of the buffer are made. The buffer is moved into the returned range if it is passed as
+ * an rvalue; lvalues are only accepted if they are borrowed ranges (like std::string_view).
+ */
+template <typename Val, std::ranges::contiguous_range Range>
+    requires(std::ranges::sized_range<Range> && std::same_as<std::ranges::range_value_t<Range>, char>)
+generator<Val &, Val> parse(Range && range)
+{
+    static_assert(detail::parsable_number<Val>,
+                  "radr::parse only supports integral types (that are not character types) and floating point types.");
+    static_assert((!std::is_lvalue_reference_v<Range> && std::movable<Range>) ||
+                    (std::ranges::borrowed_range<std::remove_reference_t<Range>> &&
+                     std::copyable<std::remove_cvref_t<Range>>),
+                  "You may pass any movable rvalue-to-range or copyable lvalues-to-borrowed_range to radr::parse.");
+
+    return detail::parse_coro<Val>(std::allocator_arg,
+                                   detail::frame_allocator(),
+                                   detail::parse_range_source<std::remove_cvref_t<Range>>{std::forward<Range>(range)});
+}
+
+} // namespace radr
@@ -0,0 +1,176 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Copyright (c) 2023-2025 Hannes Hauswedell
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See the LICENSE file for details.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <istream>
+#include <memory>
+#include <span>
+#include <type_traits>
+
+#include "../detail/block_reader.hpp"
+#include "../frame_resource.hpp"
+#include "../generator.hpp"
+
+namespace radr::detail
+{
+
+template <typename T>
+concept record_type = std::is_trivially_copyable_v<T> && std::default_initializable<T> && std::is_object_v<T> &&
+                      std::same_as<T, std::remove_cv_t<T>>;
+
+template <typename T>
+inline constexpr std::size_t default_records_per_block = std::max<std::size_t>(1, (std::size_t{1} << 16) / sizeof(T));
+
+/*!\brief Reads up to `n` records into \p buffer; returns the number of complete records read.
+ * \details
+ *
+ * ReadFn may return fewer bytes than requested, so this loops until the buffer is full or no more data is available.
+ * Fewer than `n` records are only returned at the end of input; bytes of an incomplete last record are discarded.
+ */
+template <typename T, typename ReadFn>
+std::size_t read_records(ReadFn & read_fn, T * const buffer, std::size_t const n)
+{
+    char * const      dest  = reinterpret_cast<char *>(buffer);
+    std::size_t const bytes = n * sizeof(T);
+    std::size_t       read  = 0;
+
+    while (read < bytes)
+    {
+        std::size_t const res = read_fn(dest + read, bytes - read);
+        if (res == 0)
+            break;
+        read += res;
+    }
+
+    return read / sizeof(T);
+}
+
+template <typename T, typename ReadFn, typename OnDone>
+generator<std::span<T const>, std::span<T const>> record_batches_coro(std::allocator_arg_t,
+                                                                       frame_allocator_t,
+                                                                       ReadFn      read_fn,
+                                                                       std::size_t n,
+                                                                       OnDone      on_done)
+{
+    std::unique_ptr<T[]> buffer{new T[n]};
+
+    while (true)
+    {
+        std::size_t const count = read_records(read_fn, buffer.get(), n);
+        if (count > 0)
+            co_yield std::span<T const>{buffer.get(), count};
+        if (count < n)
+            break;
+    }
+
+    on_done();
+}
+
+template <typename T, typename ReadFn, typename OnDone>
+generator<T const &, T> records_coro(std::allocator_arg_t, frame_allocator_t, ReadFn read_fn, OnDone on_done)
+{
+    std::size_t const    n = default_records_per_block<T>;
+    std::unique_ptr<T[]> buffer{new T[n]};
+
+    while (true)
+    {
+        std::size_t const count = read_records(read_fn, buffer.get(), n);
+        for (std::size_t i = 0; i < count; ++i)
+            co_yield buffer[i];
+        if (count < n)
+            break;
+    }
+
+    on_done();
+}
+
+template <typename Traits>
+auto records_on_done(std::basic_istream<char, Traits> & stream)
+{
+    return [&stream]()
+    {
+        stream.setstate(std::ios_base::eofbit | std::ios_base::failbit);
+    };
+}
+
+} // namespace radr::detail
+
+namespace radr
+{
+
+/*!\brief A range factory that reads binary records of type T from a stream.
+ * \tparam T The record type; must be trivially copyable and default-initializable.
+ * \param[in,out] stream The stream to read from (should be opened in binary mode).
+ * \details
+ *
+ * The records are read as raw bytes in large blocks via the stream buffer's `sgetn()` into a buffer of T (so the
+ * records are correctly aligned); there is no per-element formatted extraction. The bytes are interpreted in the
+ * platform's representation of T, i.e. no conversion of endianness happens.
+ *
+ * The returned range is a radr::generator of `T const &`. The references are only valid until the iterator is
+ * incremented. If the input ends inside of a record, that record is not returned. After the range is exhausted, the
+ * stream's eofbit and failbit are set.
+ *
+ * ```cpp
+ * struct sample { uint64_t time; float value; };
+ * std::ifstream file{"telemetry.bin", std::ios::binary};
+ * for (sample const & s : radr::records<sample>(file))
+ *     ...;
+ * ```
+ *
+ * See radr::record_batches for a version that returns whole blocks.
+ */
+template <typename T, class Traits>
+generator<T const &, T> records(std::basic_istream<char, Traits> & stream)
+{
+    static_assert(detail::record_type<T>,
+                  "radr::records requires a (non-const) trivially copyable, default-initializable type.");
+
+    return detail::records_coro<T>(std::allocator_arg,
+                                   detail::frame_allocator(),
+                                   detail::streambuf_read_fn<Traits>{stream.rdbuf()},
+                                   detail::records_on_done(stream));
+}
+
+/*!\brief A range factory that reads batches of binary records of type T from a stream.
+ * \tparam T The record type; must be trivially copyable and default-initializable.
+ * \param[in,out] stream The stream to read from (should be opened in binary mode).
+ * \param batch_size The number of records per batch; the default corresponds to 64KiB.
+ * \details
+ *
+ * Like radr::records, but returns `std::span<T const>` with \p batch_size records each (the last batch may be
+ * smaller). Batches are only valid until the iterator is incremented.
+ *
+ * This can be combined with radr::batch_filter and radr::batch_transform (after copying or with a transform to a
+ * different type) or processed with plain loops.
+ */
+template <typename T, class Traits>
+generator<std::span<T const>, std::span<T const>> record_batches(
+  std::basic_istream<char, Traits> & stream,
+  std::size_t const                  batch_size = detail::default_records_per_block<T>)
+{
+    static_assert(detail::record_type<T>,
+                  "radr::record_batches requires a (non-const) trivially copyable, default-initializable type.");
+    assert(batch_size > 0);
+
+    return detail::record_batches_coro<T>(std::allocator_arg,
+                                          detail::frame_allocator(),
+                                          detail::streambuf_read_fn<Traits>{stream.rdbuf()},
+                                          batch_size,
+                                          detail::records_on_done(stream));
+}
+
+} // namespace radr
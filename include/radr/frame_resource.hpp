@@ -0,0 +1,170 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Copyright (c) 2023-2025 Hannes Hauswedell
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See the LICENSE file for details.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <type_traits>
+
+namespace radr::detail
+{
+
+inline std::pmr::memory_resource *& frame_resource_ptr() noexcept
+{
+    thread_local std::pmr::memory_resource * ptr = nullptr;
+    return ptr;
+}
+
+} // namespace radr::detail
+
+namespace radr
+{
+
+/*!\brief The memory resource used for the coroutine frames of single-pass adaptors created on this thread.
+ * \details
+ *
+ * All single-pass range adaptors and factories in this library return radr::generator. Their coroutine frames are
+ * allocated from the memory resource returned by this function *at the time the adaptor is created*. The resource is
+ * stored with the frame, so it is also used for deallocation (even if that happens on another thread).
+ *
+ * The default is `std::pmr::new_delete_resource()`. Use radr::frame_resource_guard to change it.
+ */
+inline std::pmr::memory_resource * get_frame_resource() noexcept
+{
+    std::pmr::memory_resource * ptr = detail::frame_resource_ptr();
+    return ptr != nullptr ? ptr : std::pmr::new_delete_resource();
+}
+
+/*!\brief Sets the frame resource for this thread (see radr::get_frame_resource) and returns the previous one.
+ * \details
+ *
+ * Passing `nullptr` restores the default.
+ */
+inline std::pmr::memory_resource * set_frame_resource(std::pmr::memory_resource * resource) noexcept
+{
+    std::pmr::memory_resource * previous = get_frame_resource();
+    detail::frame_resource_ptr()         = resource;
+    return previous;
+}
+
+/*!\brief RAII helper that sets the frame resource (see radr::get_frame_resource) for the current scope.
+ * \details
+ *
+ * ```cpp
+ * std::pmr::monotonic_buffer_resource arena;
+ * radr::frame_resource_guard g{&arena};
+ *
+ * // all coroutine frames of this pipeline are allocated from the arena
+ * auto pipeline = radr::istream<int>(file) | radr::filter(fn) | radr::take(10);
+ * ```
+ *
+ * The resource needs to outlive all ranges created while the guard is active.
+ */
+class frame_resource_guard
+{
+    std::pmr::memory_resource * previous = nullptr;
+
+public:
+    explicit frame_resource_guard(std::pmr::memory_resource * resource) noexcept :
+      previous{detail::frame_resource_ptr()}
+    {
+        detail::frame_resource_ptr() = resource;
+    }
+
+    frame_resource_guard(frame_resource_guard const &)             = delete;
+    frame_resource_guard & operator=(frame_resource_guard const &) = delete;
+
+    ~frame_resource_guard() { detail::frame_resource_ptr() = previous; }
+};
+
+/*!\brief A thread-local pool resource that can be used as frame resource.
+ * \details
+ *
+ * This is a std::pmr::unsynchronized_pool_resource, i.e. it keeps pools of blocks keyed by size. Creating the same
+ * pipeline repeatedly on one thread will thus reuse the frames of the previous pipelines:
+ *
+ * ```cpp
+ * radr::frame_resource_guard g{radr::thread_frame_pool()};
+ * ```
+ *
+ * Since the pool is not synchronised, ranges created with it need to be destroyed on the same thread, and before the
+ * thread exits.
+ */
+inline std::pmr::memory_resource * thread_frame_pool()
+{
+    thread_local std::pmr::unsynchronized_pool_resource pool;
+    return &pool;
+}
+
+} // namespace radr
+
+namespace radr::detail
+{
+
+/*!\brief The allocator passed to all coroutines via std::allocator_arg.
+ * \details
+ *
+ * The allocator is stateless; it allocates from radr::get_frame_resource() and stores the resource in front of the
+ * allocated block, so that deallocation uses the same resource.
+ * Being stateless means that it doesn't need to be stored in the coroutine frame.
+ */
+template <typename T>
+class basic_frame_allocator
+{
+    static_assert(alignof(T) <= alignof(std::max_align_t), "Over-aligned types are not supported.");
+
+    static constexpr std::size_t max_align   = alignof(std::max_align_t);
+    static constexpr std::size_t header_size = max_align;
+    static_assert(sizeof(std::pmr::memory_resource *) <= header_size);
+
+public:
+    using value_type      = T;
+    using is_always_equal = std::true_type;
+
+    constexpr basic_frame_allocator() noexcept = default;
+
+    template <typename U>
+    constexpr basic_frame_allocator(basic_frame_allocator<U> const &) noexcept
+    {}
+
+    T * allocate(std::size_t const n)
+    {
+        std::pmr::memory_resource * resource = get_frame_resource();
+        void *                      block    = resource->allocate(header_size + n * sizeof(T), max_align);
+        ::new (block) std::pmr::memory_resource *(resource);
+        return reinterpret_cast<T *>(static_cast<std::byte *>(block) + header_size);
+    }
+
+    void deallocate(T * const p, std::size_t const n) noexcept
+    {
+        void *                      block    = reinterpret_cast<std::byte *>(p) - header_size;
+        std::pmr::memory_resource * resource = *static_cast<std::pmr::memory_resource **>(block);
+        resource->deallocate(block, header_size + n * sizeof(T), max_align);
+    }
+
+    template <typename U>
+    friend constexpr bool operator==(basic_frame_allocator const &, basic_frame_allocator<U> const &) noexcept
+    {
+        return true;
+    }
+};
+
+using frame_allocator_t = basic_frame_allocator<std::byte>;
+
+inline constexpr frame_allocator_t frame_allocator() noexcept
+{
+    return {};
+}
+
+} // namespace radr::detail
@@ -0,0 +1,499 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Copyright (c) 2023-2025 Hannes Hauswedell
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See the LICENSE file for details.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <type_traits>
+
+#include "detail/detail.hpp"
+#include "detail/simd_find.hpp"
+
+namespace radr::detail
+{
+
+template <typename T>
+concept pred_integer = std::integral<T> && !std::same_as<T, bool>;
+
+//!\brief `a < b`, but integers of different signedness are compared by value (like std::cmp_less).
+template <typename A, typename B>
+constexpr bool pred_less(A const & a, B const & b)
+{
+    if constexpr (pred_integer<A> && pred_integer<B> && std::is_signed_v<A> != std::is_signed_v<B>)
+    {
+        if constexpr (std::is_signed_v<A>)
+            return a < 0 || static_cast<std::make_unsigned_t<A>>(a) < b;
+        else
+            return b >= 0 && a < static_cast<std::make_unsigned_t<B>>(b);
+    }
+    else
+    {
+        return a < b;
+    }
+}
+
+//!\brief `a == b`, but integers of different signedness are compared by value (like std::cmp_equal).
+template <typename A, typename B>
+constexpr bool pred_equal(A const & a, B const & b)
+{
+    if constexpr (pred_integer<A> && pred_integer<B> && std::is_signed_v<A> != std::is_signed_v<B>)
+    {
+        if constexpr (std::is_signed_v<A>)
+            return a >= 0 && static_cast<std::make_unsigned_t<A>>(a) == b;
+        else
+            return b >= 0 && a == static_cast<std::make_unsigned_t<B>>(b);
+    }
+    else
+    {
+        return a == b;
+    }
+}
+
+//!\brief `a <= b`, but integers of different signedness are compared by value (false if one is NaN).
+template <typename A, typename B>
+constexpr bool pred_less_equal(A const & a, B const & b)
+{
+    if constexpr (pred_integer<A> && pred_integer<B>)
+        return !pred_less(b, a);
+    else
+        return a <= b;
+}
+
+/*!\brief Whether the value \p v of type T can be compared as a value of type U.
+ * \details
+ *
+ * This is the case for values of the same type and for integers that are representable in U. Predicates compare
+ * integers by value, so converting \p v to U does not change the result of any comparison.
+ */
+template <typename U, typename T>
+constexpr bool pred_representable_as(T const & v)
+{
+    if constexpr (std::same_as<U, T>)
+        return true;
+    else if constexpr (pred_integer<U> && pred_integer<T>)
+        return !pred_less(v, std::numeric_limits<U>::min()) && !pred_less(std::numeric_limits<U>::max(), v);
+    else
+        return false;
+}
+
+//!\brief The element type U can be searched for a value of type T with the kernels in radr/detail/simd_find.hpp.
+template <typename U, typename T>
+concept pred_simd_types = simd_comparable<U> && (std::same_as<U, T> || (pred_integer<U> && pred_integer<T>));
+
+//!\brief Returns the first element x in [b, e) for which `p(x) != Negate`, or e.
+template <bool Negate, typename U, typename Pred>
+constexpr U const * pred_find_scalar(U const * const b, U const * const e, Pred const & p)
+{
+    return std::find_if(b, e, [&p](U const & x) { return static_cast<bool>(p(x)) != Negate; });
+}
+
+/*!\brief Returns \p fn if \p valid and nothing otherwise.
+ * \details
+ *
+ * The predicates in radr::pred customise `pred_simd_mask(std::type_identity<U>, pred)` to return the function that
+ * computes the vector mask (see radr::detail::simd_eq_mask) for elements of type U, if the predicate can be evaluated
+ * with vector instructions.
+ */
+template <typename Fn>
+constexpr std::optional<Fn> pred_mask_if(bool const valid, Fn fn)
+{
+    return valid ? std::optional<Fn>{std::move(fn)} : std::nullopt;
+}
+
+} // namespace radr::detail
+
+namespace radr::pred
+{
+
+/*!\brief Predicate `x == value`.
+ * \details
+ *
+ * Like all predicates in radr::pred, this is recognised by the adaptors radr::filter, radr::take_while and
+ * radr::drop_while: on contiguous ranges of arithmetic types, they search for the next element that satisfies the
+ * predicate (or does not, in case of take_while and drop_while) with memchr or vector instructions.
+ * For other predicates, elements are checked one by one.
+ *
+ * Integers of different signedness are compared by value (like std::cmp_equal).
+ */
+template <typename T>
+struct equal_to
+{
+    T value;
+
+    constexpr explicit equal_to(T v) : value{std::move(v)} {}
+
+    template <typename U>
+    constexpr bool operator()(U const & x) const
+    {
+        return detail::pred_equal(x, value);
+    }
+
+    template <bool Negate, typename U>
+    friend constexpr U const * pred_find(std::bool_constant<Negate>, U const * b, U const * e, equal_to const & p)
+        requires(detail::pred_simd_types<U, T> && detail::simd_findable<U>)
+    {
+        if (!detail::pred_representable_as<U>(p.value))
+            return detail::pred_find_scalar<Negate>(b, e, p);
+
+        U const v = static_cast<U>(p.value);
+        return Negate ? detail::simd_find_not(b, e, v) : detail::simd_find(b, e, v);
+    }
+
+#if defined(RADR_SIMD_AVX2) || defined(RADR_SIMD_SSE2) || defined(RADR_SIMD_NEON)
+    template <typename U>
+    friend auto pred_simd_mask(std::type_identity<U>, equal_to const & p)
+        requires(detail::pred_simd_types<U, T> && detail::simd_findable<U>)
+    {
+        return detail::pred_mask_if(detail::pred_representable_as<U>(p.value),
+                                    [v = detail::simd_broadcast(static_cast<U>(p.value))](U const * const q)
+                                    { return detail::simd_eq_mask(q, v); });
+    }
+#endif
+};
+
+/*!\brief Predicate `x < value`.
+ * \details
+ *
+ * Integers of different signedness are compared by value (like std::cmp_less). See radr::pred::equal_to for
+ * more details.
+ */
+template <typename T>
+struct less
+{
+    T value;
+
+    constexpr explicit less(T v) : value{std::move(v)} {}
+
+    template <typename U>
+    constexpr bool operator()(U const & x) const
+    {
+        return detail::pred_less(x, value);
+    }
+
+    template <bool Negate, typename U>
+    friend constexpr U const * pred_find(std::bool_constant<Negate>, U const * b, U const * e, less const & p)
+        requires detail::pred_simd_types<U, T>
+    {
+        if (!detail::pred_representable_as<U>(p.value))
+            return detail::pred_find_scalar<Negate>(b, e, p);
+
+        return detail::simd_find_cmp<detail::simd_cmp::lt, Negate>(b, e, static_cast<U>(p.value));
+    }
+
+#if defined(RADR_SIMD_AVX2) || defined(RADR_SIMD_SSE2) || defined(RADR_SIMD_NEON)
+    template <typename U>
+    friend auto pred_simd_mask(std::type_identity<U>, less const & p)
+        requires(detail::pred_simd_types<U, T> && detail::simd_cmp_available<U>)
+    {
+        return detail::pred_mask_if(detail::pred_representable_as<U>(p.value),
+                                    [v = detail::simd_broadcast(static_cast<U>(p.value))](U const * const q)
+                                    { return detail::simd_cmp_mask<detail::simd_cmp::lt>(q, v); });
+    }
+#endif
+};
+
+/*!\brief Predicate `x > value`.
+ * \details
+ *
+ * Integers of different signedness are compared by value (like std::cmp_greater). See radr::pred::equal_to for
+ * more details.
+ */
+template <typename T>
+struct greater
+{
+    T value;
+
+    constexpr explicit greater(T v) : value{std::move(v)} {}
+
+    template <typename U>
+    constexpr bool operator()(U const & x) const
+    {
+        return detail::pred_less(value, x);
+    }
+
+    template <bool Negate, typename U>
+    friend constexpr U const * pred_find(std::bool_constant<Negate>, U const * b, U const * e, greater const & p)
+        requires detail::pred_simd_types<U, T>
+    {
+        if (!detail::pred_representable_as<U>(p.value))
+            return detail::pred_find_scalar<Negate>(b, e, p);
+
+        return detail::simd_find_cmp<detail::simd_cmp::gt, Negate>(b, e, static_cast<U>(p.value));
+    }
+
+#if defined(RADR_SIMD_AVX2) || defined(RADR_SIMD_SSE2) || defined(RADR_SIMD_NEON)
+    template <typename U>
+    friend auto pred_simd_mask(std::type_identity<U>, greater const & p)
+        requires(detail::pred_simd_types<U, T> && detail::simd_cmp_available<U>)
+    {
+        return detail::pred_mask_if(detail::pred_representable_as<U>(p.value),
+                                    [v = detail::simd_broadcast(static_cast<U>(p.value))](U const * const q)
+                                    { return detail::simd_cmp_mask<detail::simd_cmp::gt>(q, v); });
+    }
+#endif
+};
+
+/*!\brief Predicate `lo <= x && x <= hi` (note that both bounds are included).
+ * \details
+ *
+ * ```cpp
+ * auto digits = "a1b22c"sv | radr::filter(radr::pred::in_range('0', '9')); // "122"
+ * ```
+ *
+ * Integers of different signedness are compared by value. See radr::pred::equal_to for more details.
+ */
+template <typename T>
+struct in_range
+{
+    T lo;
+    T hi;
+
+    constexpr in_range(T lo_, T hi_) : lo{std::move(lo_)}, hi{std::move(hi_)} {}
+
+    template <typename U>
+    constexpr bool operator()(U const & x) const
+    {
+        return detail::pred_less_equal(lo, x) && detail::pred_less_equal(x, hi);
+    }
+
+    template <bool Negate, typename U>
+    friend constexpr U const * pred_find(std::bool_constant<Negate>, U const * b, U const * e, in_range const & p)
+        requires detail::pred_simd_types<U, T>
+    {
+        if (!detail::pred_representable_as<U>(p.lo) || !detail::pred_representable_as<U>(p.hi))
+            return detail::pred_find_scalar<Negate>(b, e, p);
+
+        return detail::simd_find_between<Negate>(b, e, static_cast<U>(p.lo), static_cast<U>(p.hi));
+    }
+
+#if defined(RADR_SIMD_AVX2) || defined(RADR_SIMD_SSE2) || defined(RADR_SIMD_NEON)
+    template <typename U>
+    friend auto pred_simd_mask(std::type_identity<U>, in_range const & p)
+        requires(detail::pred_simd_types<U, T> && detail::simd_cmp_available<U>)
+    {
+        auto mask_fn = [lo = detail::simd_broadcast(static_cast<U>(p.lo)),
+                        hi = detail::simd_broadcast(static_cast<U>(p.hi))](U const * const q)
+        {
+            return detail::simd_cmp_mask<detail::simd_cmp::ge>(q, lo) &
+                   detail::simd_cmp_mask<detail::simd_cmp::le>(q, hi);
+        };
+        return detail::pred_mask_if(detail::pred_representable_as<U>(p.lo) && detail::pred_representable_as<U>(p.hi),
+                                    mask_fn);
+    }
+#endif
+};
+
+/*!\brief Predicate that is true for elements equal to one of the given values.
+ * \details
+ *
+ * ```cpp
+ * auto word = "  \tfoo bar"sv | radr::drop_while(radr::pred::any_of_set{' ', '\t'}); // "foo bar"
+ * ```
+ *
+ * For characters (and other integral types of size 1), the values are stored in a 256-bit table, and vectors of
+ * elements are classified with byte shuffles (see radr::split_any). For other types, every vector of elements is
+ * compared with every value, so the number of values should be small.
+ *
+ * Only elements of the same type as the values are searched with vector instructions. See radr::pred::equal_to for
+ * more details.
+ */
+template <typename T, size_t N>
+class any_of_set
+{
+    /* the values are not modifiable, because set_ is built from them */
+    std::array<T, N> values_;
+
+    [[no_unique_address]] std::conditional_t<detail::byte_like<T>, detail::byte_set, detail::empty_t> set_{};
+
+public:
+    template <std::convertible_to<T>... Ts>
+        requires(sizeof...(Ts) == N)
+    constexpr explicit any_of_set(Ts const &... vs) : values_{static_cast<T>(vs)...}
+    {
+        if constexpr (detail::byte_like<T>)
+            for (T const v : values_)
+                set_.insert(static_cast<uint8_t>(v));
+    }
+
+    //!\brief The values.
+    constexpr std::array<T, N> const & values() const noexcept { return values_; }
+
+    template <typename U>
+    constexpr bool operator()(U const & x) const
+    {
+        if constexpr (detail::byte_like<T> && std::same_as<U, T>)
+            return set_.contains(static_cast<uint8_t>(x));
+        else
+            return std::ranges::any_of(values_, [&x](T const & v) { return detail::pred_equal(x, v); });
+    }
+
+    template <bool Negate, typename U>
+    friend constexpr U const * pred_find(std::bool_constant<Negate>, U const * b, U const * e, any_of_set const & p)
+        requires(std::same_as<U, T> && detail::simd_findable<U>)
+    {
+        if constexpr (detail::byte_like<T>)
+            return detail::simd_find_any<Negate>(b, e, p.set_);
+        else
+            return detail::simd_find_any_of<Negate>(b, e, p.values_);
+    }
+
+#if defined(RADR_SIMD_AVX2) || defined(RADR_SIMD_SSE2) || defined(RADR_SIMD_NEON)
+    template <typename U>
+    friend auto pred_simd_mask(std::type_identity<U>, any_of_set const & p)
+        requires(std::same_as<U, T> && detail::simd_findable<U> && (!detail::byte_like<U> || detail::simd_has_shuffle))
+    {
+#    if defined(RADR_SIMD_SHUFFLE)
+        if constexpr (detail::byte_like<U>)
+        {
+            return std::optional{[vset = detail::simd_byte_set(p.set_)](U const * const q)
+                                 { return detail::simd_byte_set_mask(reinterpret_cast<uint8_t const *>(q), vset); }};
+        }
+        else
+#    endif
+        {
+            detail::simd_vec_t needles[N];
+            for (size_t i = 0; i < N; ++i)
+                needles[i] = detail::simd_broadcast(p.values_[i]);
+
+            return std::optional{[needles](U const * const q)
+                                 {
+                                     detail::simd_mask_t mask = 0;
+                                     for (size_t i = 0; i < N; ++i)
+                                         mask |= detail::simd_eq_mask(q, needles[i]);
+                                     return mask;
+                                 }};
+        }
+    }
+#endif
+};
+
+template <typename T, typename... Ts>
+any_of_set(T, Ts...) -> any_of_set<T, 1 + sizeof...(Ts)>;
+
+} // namespace radr::pred
+
+namespace radr::detail
+{
+
+//!\brief Fn is a predicate from radr::pred that can be searched for with vector instructions in [It, Sen).
+template <typename Fn, typename It, typename Sen>
+concept pred_vectorisable =
+  std::contiguous_iterator<It> && std::sized_sentinel_for<Sen, It> &&
+  requires(std::iter_value_t<It> const * p, Fn const & fn) { pred_find(std::true_type{}, p, p, fn); } &&
+  requires(std::iter_value_t<It> const * p, Fn const & fn) { pred_find(std::false_type{}, p, p, fn); };
+
+/*!\brief Like std::ranges::find_if (or find_if_not if Negate), but recognises the predicates from radr::pred.
+ * \details
+ *
+ * If the predicate is from radr::pred, the iterator is contiguous and the elements are arithmetic, the search is
+ * vectorised (outside of constant evaluation).
+ */
+template <bool Negate, std::forward_iterator It, std::sentinel_for<It> Sen, typename Fn>
+constexpr It pred_find_if_impl(It b, Sen const & e, Fn const & fn)
+{
+    if constexpr (pred_vectorisable<Fn, It, Sen>)
+    {
+        if (!std::is_constant_evaluated())
+        {
+            using U              = std::iter_value_t<It>;
+            U const * const pb   = std::to_address(b);
+            U const * const pe   = pb + (e - b);
+            U const * const next = pred_find(std::bool_constant<Negate>{}, pb, pe, fn);
+            return b + (next - pb);
+        }
+    }
+
+    if constexpr (Negate)
+        return std::ranges::find_if_not(std::move(b), e, std::cref(fn));
+    else
+        return std::ranges::find_if(std::move(b), e, std::cref(fn));
+}
+
+//!\brief Like std::ranges::find_if, but vectorised for the predicates from radr::pred (see above).
+template <std::forward_iterator It, std::sentinel_for<It> Sen, typename Fn>
+constexpr It pred_find_if(It b, Sen const & e, Fn const & fn)
+{
+    return pred_find_if_impl<false>(std::move(b), e, fn);
+}
+
+//!\brief Like std::ranges::find_if_not, but vectorised for the predicates from radr::pred (see above).
+template <std::forward_iterator It, std::sentinel_for<It> Sen, typename Fn>
+constexpr It pred_find_if_not(It b, Sen const & e, Fn const & fn)
+{
+    return pred_find_if_impl<true>(std::move(b), e, fn);
+}
+
+//!\brief The number of elements that radr::detail::pred_copy_if collects before writing them to the output.
+inline constexpr size_t pred_copy_buffer_size = 256;
+
+/*!\brief Like std::ranges::copy_if, but evaluates the predicate without branches.
+ * \details
+ *
+ * The selected elements are collected in a buffer on the stack: every element is written to the buffer, but the
+ * position is only advanced if \p fn returns true. This avoids branch mispredictions if the predicate is
+ * unpredictable (e.g. if about half of the elements are selected).
+ *
+ * If \p fn is a predicate from radr::pred, vectors of elements are evaluated at once, and the selected elements are
+ * compressed via radr::detail::simd_compress.
+ */
+template <typename U, typename Fn, std::weakly_incrementable Out>
+    requires std::is_trivially_copyable_v<U>
+constexpr Out pred_copy_if(U const * b, U const * const e, Fn const & fn, Out out)
+{
+    if (std::is_constant_evaluated())
+        return std::ranges::copy_if(b, e, std::move(out), std::cref(fn)).out;
+
+    U      buf[pred_copy_buffer_size + 64 / sizeof(U)]; // room for writing a full vector behind the last element
+    size_t n     = 0;
+    auto   flush = [&]()
+    {
+        out = std::ranges::copy(buf, buf + n, std::move(out)).out;
+        n   = 0;
+    };
+
+#if defined(RADR_SIMD_AVX2) || defined(RADR_SIMD_SSE2) || defined(RADR_SIMD_NEON)
+    if constexpr (requires { pred_simd_mask(std::type_identity<U>{}, fn); })
+    {
+        if (auto const mask_fn = pred_simd_mask(std::type_identity<U>{}, fn))
+        {
+            constexpr size_t lanes = simd_width / sizeof(U);
+            for (; static_cast<size_t>(e - b) >= lanes; b += lanes)
+            {
+                n += simd_compress(b, (*mask_fn)(b), buf + n);
+                if (n >= pred_copy_buffer_size)
+                    flush();
+            }
+        }
+    }
+#endif
+
+    for (; b != e; ++b)
+    {
+        buf[n] = *b;
+        n += static_cast<size_t>(static_cast<bool>(std::invoke(fn, *b)));
+        if (n == pred_copy_buffer_size)
+            flush();
+    }
+
+    flush();
+    return out;
+}
+
+} // namespace radr::detail
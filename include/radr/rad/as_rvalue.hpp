@@ -17,6 +17,7 @@
 #include "../concepts.hpp"
 #include "../detail/detail.hpp"
 #include "../detail/pipe.hpp"
+#include "../frame_resource.hpp"
 #include "../generator.hpp"
 #include "../rad_util/borrowing_rad.hpp"
 
@@ -73,20 +74,18 @@ inline constexpr auto as_rvalue_coro = []<std::ranges::input_range URange>(URang
     static_assert(std::movable<URange>, RADR_ASSERTSTRING_MOVABLE);
 
     // we need to create inner functor so that it can take by value
-    return [](auto urange_)
+    return [](std::allocator_arg_t, frame_allocator_t, auto urange_)
              -> radr::generator<std::ranges::range_rvalue_reference_t<URange>, std::ranges::range_value_t<URange>>
     {
-        if constexpr (
-          std::same_as<std::ranges::range_reference_t<URange>, std::ranges::range_rvalue_reference_t<URange>>)
+        for (auto && elem : urange_)
         {
-            co_yield elements_of(urange_);
-        }
-        else
-        {
-            for (auto && elem : urange_)
+            if constexpr (
+              std::same_as<std::ranges::range_reference_t<URange>, std::ranges::range_rvalue_reference_t<URange>>)
+                co_yield std::forward<decltype(elem)>(elem);
+            else
                 co_yield std::move(elem);
         }
-    }(std::move(urange));
+    }(std::allocator_arg, frame_allocator(), std::move(urange));
 };
 
 } // namespace radr::detail
@@ -0,0 +1,340 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Copyright (c) 2023-2025 Hannes Hauswedell
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See the LICENSE file for details.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <ranges>
+#include <span>
+
+#include "../concepts.hpp"
+#include "../detail/detail.hpp"
+#include "../detail/pipe.hpp"
+#include "../frame_resource.hpp"
+#include "../generator.hpp"
+
+namespace radr::detail
+{
+
+/*!\brief The reference type of radr::batch, radr::batch_transform and radr::batch_filter.
+ * \details
+ *
+ * A std::span into a buffer that belongs to the adaptor. This type signals to the next batch adaptor that it may
+ * modify the elements in-place; other ranges of batches (e.g. of std::span) are not modified.
+ */
+template <typename T>
+class batch_span : public std::span<T>
+{
+public:
+    using std::span<T>::span;
+};
+
+template <typename T>
+inline constexpr bool is_batch_span = false;
+
+template <typename T>
+inline constexpr bool is_batch_span<batch_span<T>> = true;
+
+//!\brief Whether the batches of URange belong to the upstream batch adaptor (and may be modified in-place).
+template <typename URange>
+inline constexpr bool batches_owned = is_batch_span<std::remove_cvref_t<std::ranges::range_reference_t<URange>>>;
+
+/*!\brief The reused buffer of the batch adaptors.
+ * \details
+ *
+ * Like std::vector, but contiguous for every element type (including bool). Elements are only constructed when they
+ * are added (they need not be default-constructible).
+ */
+template <typename T>
+class batch_buffer
+{
+    std::allocator<T> alloc;
+    T *               data_ = nullptr;
+    std::size_t       size_ = 0;
+    std::size_t       cap_  = 0;
+
+public:
+    batch_buffer() = default;
+
+    batch_buffer(batch_buffer const &)             = delete;
+    batch_buffer & operator=(batch_buffer const &) = delete;
+
+    ~batch_buffer()
+    {
+        clear();
+        if (data_ != nullptr)
+            alloc.deallocate(data_, cap_);
+    }
+
+    T *         data() noexcept { return data_; }
+    std::size_t size() const noexcept { return size_; }
+    bool        empty() const noexcept { return size_ == 0; }
+
+    void reserve(std::size_t const n)
+    {
+        if (n <= cap_)
+            return;
+
+        T * const new_data = alloc.allocate(n);
+        try
+        {
+            std::uninitialized_move(data_, data_ + size_, new_data);
+        }
+        catch (...)
+        {
+            alloc.deallocate(new_data, n);
+            throw;
+        }
+
+        if (data_ != nullptr)
+        {
+            std::destroy_n(data_, size_);
+            alloc.deallocate(data_, cap_);
+        }
+        data_ = new_data;
+        cap_  = n;
+    }
+
+    template <typename... Args>
+    void emplace_back(Args &&... args)
+    {
+        if (size_ == cap_)
+            reserve(std::max<std::size_t>(1, 2 * cap_));
+        std::construct_at(data_ + size_, std::forward<Args>(args)...);
+        ++size_;
+    }
+
+    void clear() noexcept
+    {
+        std::destroy_n(data_, size_);
+        size_ = 0;
+    }
+};
+
+template <typename URange>
+concept batched_range = std::ranges::input_range<URange> &&
+                        std::ranges::contiguous_range<std::ranges::range_reference_t<URange>> &&
+                        std::ranges::sized_range<std::ranges::range_reference_t<URange>>;
+
+inline constexpr auto batch_coro = []<std::ranges::input_range URange>(URange && urange, std::size_t const n)
+{
+    static_assert(!std::is_lvalue_reference_v<URange>, RADR_ASSERTSTRING_RVALUE);
+    static_assert(std::movable<URange>, RADR_ASSERTSTRING_MOVABLE);
+
+    using val_t = std::ranges::range_value_t<URange>;
+    static_assert(std::constructible_from<val_t, std::ranges::range_reference_t<URange>>,
+                  "The elements of the range must be convertible to its value_type.");
+
+    assert(n > 0);
+
+    return [](std::allocator_arg_t, frame_allocator_t, auto urange_, std::size_t const n)
+             -> radr::generator<batch_span<val_t>, std::span<val_t>>
+    {
+        batch_buffer<val_t> buffer;
+        buffer.reserve(n);
+
+        auto it = radr::begin(urange_);
+        auto e  = radr::end(urange_);
+
+        while (it != e)
+        {
+            buffer.clear();
+            /* the underlying iterator is not incremented after the last element of a batch */
+            while (true)
+            {
+                buffer.emplace_back(*it);
+                if (buffer.size() == n)
+                    break;
+                ++it;
+                if (it == e)
+                    break;
+            }
+
+            co_yield batch_span<val_t>{buffer.data(), buffer.size()};
+
+            if (buffer.size() == n)
+                ++it;
+        }
+    }(std::allocator_arg, frame_allocator(), std::move(urange), n);
+};
+
+inline constexpr auto batch_transform_coro = []<batched_range URange, typename Fn>(URange && urange, Fn fn)
+{
+    static_assert(!std::is_lvalue_reference_v<URange>, RADR_ASSERTSTRING_RVALUE);
+    static_assert(std::movable<URange>, RADR_ASSERTSTRING_MOVABLE);
+
+    using in_ref_t = std::ranges::range_reference_t<std::ranges::range_reference_t<URange>>;
+    static_assert(std::move_constructible<Fn> && std::invocable<Fn &, in_ref_t>,
+                  "The constraints for radr::batch_transform's functor are not met.");
+    using out_t = std::remove_cvref_t<std::invoke_result_t<Fn &, in_ref_t>>;
+
+    return [](std::allocator_arg_t, frame_allocator_t, auto urange_, Fn fn_)
+             -> radr::generator<batch_span<out_t>, std::span<out_t>>
+    {
+        if constexpr (batches_owned<URange> && std::same_as<std::remove_reference_t<in_ref_t>, out_t>)
+        {
+            /* the batches belong to the upstream adaptor and the result type is the same → transform in-place */
+            for (auto && batch : urange_)
+            {
+                for (out_t & elem : batch)
+                    elem = fn_(elem);
+
+                co_yield batch_span<out_t>{std::ranges::data(batch), std::ranges::size(batch)};
+            }
+        }
+        else
+        {
+            batch_buffer<out_t> buffer;
+            for (auto && batch : urange_)
+            {
+                buffer.clear();
+                buffer.reserve(std::ranges::size(batch));
+                for (auto && elem : batch)
+                    buffer.emplace_back(fn_(elem));
+
+                co_yield batch_span<out_t>{buffer.data(), buffer.size()};
+            }
+        }
+    }(std::allocator_arg, frame_allocator(), std::move(urange), std::move(fn));
+};
+
+inline constexpr auto batch_filter_coro = []<batched_range URange, typename Fn>(URange && urange, Fn fn)
+{
+    static_assert(!std::is_lvalue_reference_v<URange>, RADR_ASSERTSTRING_RVALUE);
+    static_assert(std::movable<URange>, RADR_ASSERTSTRING_MOVABLE);
+
+    using inner_t = std::remove_reference_t<std::ranges::range_reference_t<URange>>;
+    using in_t    = std::remove_reference_t<std::ranges::range_reference_t<inner_t>>;
+    using val_t   = std::remove_cv_t<in_t>;
+    static_assert(weak_indirect_unary_invocable<Fn, in_t *>,
+                  "The constraints for radr::batch_filter's functor are not satisfied.");
+
+    return [](std::allocator_arg_t, frame_allocator_t, auto urange_, Fn fn_)
+             -> radr::generator<batch_span<val_t>, std::span<val_t>>
+    {
+        if constexpr (batches_owned<URange>)
+        {
+            for (auto && batch : urange_)
+            {
+                /* compact in-place (this is what std::remove_if does) */
+                val_t * const b   = std::ranges::data(batch);
+                val_t * const e   = b + std::ranges::size(batch);
+                val_t *       out = b;
+                for (val_t * it = b; it != e; ++it)
+                {
+                    if (fn_(*it))
+                    {
+                        if (out != it)
+                            *out = std::move(*it);
+                        ++out;
+                    }
+                }
+
+                if (out != b) // empty batches are skipped
+                    co_yield batch_span<val_t>{b, out};
+            }
+        }
+        else
+        {
+            /* the batches belong to someone else → copy the selected elements into a buffer */
+            batch_buffer<val_t> buffer;
+            for (auto && batch : urange_)
+            {
+                buffer.clear();
+                for (in_t & elem : batch)
+                    if (fn_(elem))
+                        buffer.emplace_back(elem);
+
+                if (!buffer.empty()) // empty batches are skipped
+                    co_yield batch_span<val_t>{buffer.data(), buffer.size()};
+            }
+        }
+    }(std::allocator_arg, frame_allocator(), std::move(urange), std::move(fn));
+};
+
+} // namespace radr::detail
+
+namespace radr
+{
+
+inline namespace cpo
+{
+
+/*!\brief Buffers elements of a range and returns them in batches (spans).
+ * \param urange The underlying range.
+ * \param n The (maximum) size of the batches.
+ * \details
+ *
+ * This is a single-pass adaptor. The elements of \p urange are moved/copied into a buffer which is reused for all
+ * batches; the batches are `std::span<range_value_t<URange>>` into that buffer. Each batch has size \p n, except
+ * possibly the last. A batch becomes invalid when the iterator is incremented.
+ *
+ * The main purpose of this adaptor is to reduce the per-element cost of single-pass pipelines: once elements are
+ * batched, further processing can use radr::batch_transform and radr::batch_filter which run tight loops over the
+ * batches, i.e. the cost of resuming the coroutines is paid once per batch instead of once per element.
+ * Use radr::join to turn a range of batches into a range of elements again.
+ *
+ * ```cpp
+ * auto r = radr::istream<int>(stream)
+ *        | radr::batch(1024)
+ *        | radr::batch_filter(fn)
+ *        | radr::batch_transform(fn2);
+ *
+ * for (std::span<int> batch : r)
+ *     for (int i : batch)
+ *         ...;
+ * ```
+ *
+ * Requirements:
+ *   * `std::ranges::input_range<URange>`
+ *   * \p urange must be an rvalue.
+ *   * `n > 0`
+ *
+ * The underlying iterator is not incremented beyond the last element of a batch until the next batch is requested.
+ */
+inline constexpr auto batch = detail::pipe_with_args_fn<decltype(detail::batch_coro), void>{};
+
+/*!\brief Transforms a range of batches (see radr::batch) by applying an invocable on each element.
+ * \param urange The underlying range of batches.
+ * \param fn The invocable to apply.
+ * \details
+ *
+ * If \p urange is radr::batch or another batch adaptor and the invocable returns the element type of the batches, the
+ * transformation happens in-place. Otherwise, the results are stored in a buffer that is reused for all batches; in
+ * particular, batches that belong to the caller (e.g. a range of std::span) are never modified.
+ *
+ * Requirements:
+ *   * \p urange is an input range of std::ranges::contiguous_range and std::ranges::sized_range.
+ *   * \p fn is std::move_constructible and std::invocable with the batches' elements.
+ */
+inline constexpr auto batch_transform = detail::pipe_with_args_fn<decltype(detail::batch_transform_coro), void>{};
+
+/*!\brief Filters a range of batches (see radr::batch) by removing elements that don't satisfy the predicate.
+ * \param urange The underlying range of batches.
+ * \param fn The predicate.
+ * \details
+ *
+ * If \p urange is radr::batch or another batch adaptor, the batches are compacted in-place. Otherwise, the selected
+ * elements are copied into a buffer that is reused for all batches; batches that belong to the caller (e.g. a range
+ * of std::span) are never modified. Batches that are empty after filtering are skipped.
+ *
+ * Requirements:
+ *   * \p urange is an input range of std::ranges::contiguous_range and std::ranges::sized_range.
+ *   * \p fn is a predicate callable with the batches' elements.
+ */
+inline constexpr auto batch_filter = detail::pipe_with_args_fn<decltype(detail::batch_filter_coro), void>{};
+
+} // namespace cpo
+} // namespace radr
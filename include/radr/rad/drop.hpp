@@ -18,6 +18,7 @@
 #include "../custom/subborrow.hpp"
 #include "../detail/detail.hpp"
 #include "../detail/pipe.hpp"
+#include "../frame_resource.hpp"
 #include "../generator.hpp"
 
 namespace radr::detail
@@ -50,9 +51,8 @@ inline constexpr auto drop_coro = []<std::ranges::input_range URange>(URange &&
     static_assert(std::movable<URange>, RADR_ASSERTSTRING_MOVABLE);
 
     // we need to create inner functor so that it can drop by value
-    return
-      [](auto         urange_,
-         size_t const n) -> radr::generator<std::ranges::range_reference_t<URange>, std::ranges::range_value_t<URange>>
+    return [](std::allocator_arg_t, frame_allocator_t, auto urange_, size_t const n)
+             -> radr::generator<std::ranges::range_reference_t<URange>, std::ranges::range_value_t<URange>>
     {
         auto it = radr::begin(urange_);
         auto e  = radr::end(urange_);
@@ -60,7 +60,7 @@ inline constexpr auto drop_coro = []<std::ranges::input_range URange>(URange &&
         std::ranges::advance(it, n, e);
         for (; it != e; ++it)
             co_yield *it;
-    }(std::move(urange), n);
+    }(std::allocator_arg, frame_allocator(), std::move(urange), n);
 };
 
 } // namespace radr::detail
@@ -17,7 +17,9 @@
 #include "../custom/subborrow.hpp"
 #include "../detail/detail.hpp"
 #include "../detail/pipe.hpp"
+#include "../frame_resource.hpp"
 #include "../generator.hpp"
+#include "../pred.hpp"
 
 namespace radr::detail
 {
@@ -31,8 +33,17 @@ inline constexpr auto drop_while_borrow =
     auto e  = radr::end(urange);
 
     size_t count = 0ull;
-    for (; it != e && fn(*it); ++it, ++count)
+    if constexpr (pred_vectorisable<Fn, decltype(it), decltype(e)>)
     {
+        auto const next = pred_find_if_not(it, e, fn);
+        count           = static_cast<size_t>(next - it);
+        it              = next;
+    }
+    else
+    {
+        for (; it != e && fn(*it); ++it, ++count)
+        {
+        }
     }
 
     if constexpr (std::ranges::sized_range<URange>)
@@ -55,8 +66,8 @@ inline constexpr auto drop_while_coro =
     static_assert(std::movable<URange>, RADR_ASSERTSTRING_MOVABLE);
 
     // we need to create inner functor so that it can drop by value
-    return [](auto urange_,
-              Fn   fn_) -> radr::generator<std::ranges::range_reference_t<URange>, std::ranges::range_value_t<URange>>
+    return [](std::allocator_arg_t, frame_allocator_t, auto urange_, Fn fn_)
+             -> radr::generator<std::ranges::range_reference_t<URange>, std::ranges::range_value_t<URange>>
     {
         auto it = radr::begin(urange_);
         auto e  = radr::end(urange_);
@@ -67,7 +78,7 @@ inline constexpr auto drop_while_coro =
 
         for (; it != e; ++it)
             co_yield *it;
-    }(std::move(urange), fn);
+    }(std::allocator_arg, frame_allocator(), std::move(urange), fn);
 };
 
 } // namespace radr::detail
@@ -94,6 +105,9 @@ inline namespace cpo
  *
  * This adaptor always invokes the radr::subborrow customisation point.
  *
+ * If the predicate is one of the function objects in radr::pred and the underlying range is contiguous and holds
+ * arithmetic values, the first element that does not satisfy the predicate is searched with vector instructions.
+ *
  * Unless customised otherwise, this adaptor preserves:
  *   * categories up to std::ranges::contiguous_range
  *   * std::ranges::borrowed_range
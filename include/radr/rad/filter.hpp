@@ -16,12 +16,15 @@
 #include <functional>
 #include <iterator>
 #include <ranges>
+#include <vector>
 
 #include "../concepts.hpp"
 #include "../detail/detail.hpp"
 #include "../detail/pipe.hpp"
 #include "../detail/semiregular_box.hpp"
+#include "../frame_resource.hpp"
 #include "../generator.hpp"
+#include "../pred.hpp"
 #include "../range_access.hpp"
 #include "radr/custom/tags.hpp"
 
@@ -95,6 +98,48 @@ class filter_iterator
         return subborrow_impl(it, sen, s);
     }
 
+    /*!\brief Customisation for radr::subdivide that cuts the underlying range.
+     * \details
+     *
+     * The parts are balanced by the number of underlying elements, not by the number of elements that satisfy the
+     * predicate. The first element of each part is searched on the calling thread. Empty parts are skipped.
+     * If \p e is a filter_iterator, the underlying range is cut up to its position; otherwise up to the underlying end.
+     */
+    template <borrowed_mp_range R, typename Sen>
+        requires(std::random_access_iterator<Iter> && std::sized_sentinel_for<Sent, Iter> &&
+                 one_of<Sen, filter_iterator, std::default_sentinel_t>)
+    constexpr friend auto tag_invoke(custom::subdivide_tag,
+                                     R &&,
+                                     filter_iterator const & it,
+                                     Sen const &             e,
+                                     size_t const            k)
+    {
+        using RIt    = filter_iterator<Iter, Iter, Func>;
+        using part_t = decltype(borrowing_rad{std::declval<RIt>(), std::declval<RIt>(), not_size{}});
+        std::vector<part_t> parts;
+
+        Iter const ubeg = it.base_iter();
+        Iter       uend = ubeg;
+        if constexpr (std::same_as<Sen, filter_iterator>)
+            uend = e.current_;
+        else
+            uend = ubeg + (it.base_sent() - ubeg);
+
+        size_t const n = static_cast<size_t>(uend - ubeg);
+        size_t const p = std::min(k, n);
+        parts.reserve(p);
+
+        for (size_t i = 0; i < p; ++i)
+        {
+            Iter const pe = ubeg + n * (i + 1) / p;
+            Iter const pb = pred_find_if(ubeg + n * i / p, pe, it.func());
+            if (pb != pe)
+                parts.push_back(part_t{RIt{it.func(), pb, pe}, RIt{it.func(), pe, pe}, not_size{}});
+        }
+
+        return parts;
+    }
+
     //!\brief Customisation to create common sentinel with actual underlying end.
     constexpr friend filter_iterator tag_invoke(custom::find_common_end_tag,
                                                 filter_iterator it,
@@ -141,6 +186,28 @@ class filter_iterator
         return {std::move(fn), std::move(it_end), std::move(uend)};
     }
 
+    /*!\brief Customisation for radr::copy on contiguous ranges of arithmetic values.
+     * \details
+     *
+     * The predicate is evaluated without branches and the selected elements are buffered; radr::pred predicates are
+     * evaluated on vectors of elements (see radr::detail::pred_copy_if).
+     */
+    template <one_of<filter_iterator, std::default_sentinel_t> Sen, std::weakly_incrementable Out>
+        requires(std::contiguous_iterator<Iter> && std::sized_sentinel_for<Sent, Iter> &&
+                 std::is_arithmetic_v<std::iter_value_t<Iter>> &&
+                 std::indirectly_copyable<std::iter_value_t<Iter> const *, Out>)
+    constexpr friend Out tag_invoke(custom::copy_tag, filter_iterator const & b, Sen const & e, Out out)
+    {
+        std::iter_value_t<Iter> const * const pb = std::to_address(b.current_);
+        std::iter_value_t<Iter> const *       pe = nullptr;
+        if constexpr (std::same_as<Sen, filter_iterator>)
+            pe = pb + (e.current_ - b.current_);
+        else
+            pe = pb + (b.end_ - b.current_);
+
+        return pred_copy_if(pb, pe, *b.func_, std::move(out));
+    }
+
 public:
     using iterator_concept =
       std::conditional_t<std::bidirectional_iterator<Iter>, std::bidirectional_iterator_tag, std::forward_iterator_tag>;
@@ -174,7 +241,7 @@ public:
 
     constexpr filter_iterator & operator++()
     {
-        current_ = std::ranges::find_if(std::move(++current_), end_, std::cref(*func_));
+        current_ = pred_find_if(std::move(++current_), end_, *func_);
 
         return *this;
     }
@@ -238,7 +305,7 @@ inline constexpr auto filter_borrow_impl =
     using BorrowingRad = borrowing_rad<CIt, CSen, CIt, CSen, borrowing_rad_kind::unsized>;
 
     // eagerly search for begin
-    auto begin = std::ranges::find_if(it, sen, std::ref(_fn));
+    auto begin = pred_find_if(it, sen, _fn);
 
     return BorrowingRad{
       CIt{_fn, std::move(begin), std::move(sen)},
@@ -271,13 +338,13 @@ inline constexpr auto filter_coro = []<std::ranges::input_range URange, typename
                   "The constraints for radr::take_while's functor are not satisfied.");
 
     // we need to create inner functor so that it can take by value
-    return [](auto urange_,
-              Fn   fn_) -> radr::generator<std::ranges::range_reference_t<URange>, std::ranges::range_value_t<URange>>
+    return [](std::allocator_arg_t, frame_allocator_t, auto urange_, Fn fn_)
+             -> radr::generator<std::ranges::range_reference_t<URange>, std::ranges::range_value_t<URange>>
     {
         for (auto && elem : urange_)
             if (fn_(elem))
                 co_yield elem;
-    }(std::move(urange), std::move(fn));
+    }(std::allocator_arg, frame_allocator(), std::move(urange), std::move(fn));
 };
 
 } // namespace radr::detail
@@ -317,6 +384,11 @@ inline namespace cpo
  *
  * Multiple nested filter adaptors are folded into one.
  *
+ * If the predicate is one of the function objects in radr::pred (e.g. `radr::pred::equal_to(x)` or
+ * `radr::pred::in_range(lo, hi)`) and the underlying range is contiguous and holds arithmetic values, the next
+ * matching element is searched with memchr or vector instructions. This is much faster for filters that match few
+ * elements.
+ *
  * ### Notable differences to std::views::filter
  *
  * Like all our multi-pass adaptors (but unlike std::views::filter), this adaptor is const-iterable.
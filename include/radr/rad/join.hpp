@@ -12,12 +12,18 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
 #include <iterator>
 #include <ranges>
+#include <span>
+#include <vector>
 
+#include "../custom/for_each_segment.hpp"
 #include "../custom/subborrow.hpp"
 #include "../detail/detail.hpp"
 #include "../detail/pipe.hpp"
+#include "../frame_resource.hpp"
 #include "../range_access.hpp"
 
 namespace radr::detail
@@ -34,7 +40,14 @@ private:
     static constexpr bool bidi =
       std::bidirectional_iterator<UIt> && std::ranges::bidirectional_range<Inner> && common_range<Inner>;
 
-    static constexpr bool bidi_common = bidi && std::same_as<UIt, USen>;
+    /* If the inner ranges are contiguous and sized (e.g. std::vector<std::string>), the begin of the current inner
+     * range is cheap to recompute from *outer_it, and the begin of the outer range is not needed at all. This makes the
+     * iterator as small as that of the forward-only version. */
+    static constexpr bool compact = std::ranges::contiguous_range<Inner> && std::ranges::sized_range<Inner>;
+
+    static constexpr bool store_begin = bidi && !compact;
+
+    static constexpr bool bidi_common = store_begin && std::same_as<UIt, USen>;
 
     //!\brief If we use empty_t defined in detail/detail.hpp, it is not optimised out ¯\_(ツ)_/¯
     struct empty_t
@@ -43,12 +56,12 @@ private:
         constexpr empty_t(auto &&) noexcept {}
     };
 
-    [[no_unique_address]] std::conditional_t<bidi, UIt, empty_t>     outer_begin{}; // begin of underlying outer rng
-    [[no_unique_address]] UIt                                        outer_it{};    // position in underlying outer rng
-    [[no_unique_address]] USen                                       outer_end{};   // end of underlying outer rng
-    [[no_unique_address]] std::conditional_t<bidi, InnerIt, empty_t> inner_begin{}; // begin of underlying inner rng
-    [[no_unique_address]] InnerIt                                    inner_it{};    // position in underlying inner rng
-    [[no_unique_address]] InnerSen                                   inner_end{};   // end of underlying inner rng
+    [[no_unique_address]] std::conditional_t<store_begin, UIt, empty_t>     outer_begin{}; // begin of outer rng
+    [[no_unique_address]] UIt                                               outer_it{};    // position in outer rng
+    [[no_unique_address]] USen                                              outer_end{};   // end of outer rng
+    [[no_unique_address]] std::conditional_t<store_begin, InnerIt, empty_t> inner_begin{}; // begin of inner rng
+    [[no_unique_address]] InnerIt                                           inner_it{};    // position in inner rng
+    [[no_unique_address]] InnerSen                                          inner_end{};   // end of inner rng
 
     void update_inner()
     {
@@ -67,6 +80,15 @@ private:
         }
     }
 
+    //!\brief The begin of the current inner range.
+    constexpr InnerIt current_inner_begin() const
+    {
+        if constexpr (store_begin)
+            return inner_begin;
+        else
+            return radr::begin(borrow(*outer_it));
+    }
+
     template <std::forward_iterator UIt2, std::sentinel_for<UIt2> USen2>
         requires borrowed_mp_range<std::iter_reference_t<UIt2>>
     friend class join_rad_iterator;
@@ -80,15 +102,45 @@ private:
         if (it == join_rad_iterator{})
             return it;
 
-        auto inner_range_old = borrow(*it.outer_it);
+        auto rebind_outer = [&]
+        {
+            if constexpr (store_begin)
+                it.outer_begin =
+                  tag_invoke(custom::rebind_iterator_tag{}, it.outer_begin, container_old, container_new);
+            it.outer_it  = tag_invoke(custom::rebind_iterator_tag{}, it.outer_it, container_old, container_new);
+            it.outer_end = tag_invoke(custom::rebind_iterator_tag{}, it.outer_end, container_old, container_new);
+        };
 
-        if constexpr (bidi)
-            it.outer_begin = tag_invoke(custom::rebind_iterator_tag{}, it.outer_begin, container_old, container_new);
-        it.outer_it  = tag_invoke(custom::rebind_iterator_tag{}, it.outer_it, container_old, container_new);
-        it.outer_end = tag_invoke(custom::rebind_iterator_tag{}, it.outer_end, container_old, container_new);
+        /* At the end, outer_it cannot be dereferenced. In the bidi_common case, the inner iterators point into
+         * the last inner range; otherwise they are not used. */
+        if (it.outer_it == it.outer_end)
+        {
+            if constexpr (bidi_common)
+            {
+                if (it.outer_begin != it.outer_end)
+                {
+                    auto inner_range_old = borrow(*std::ranges::prev(it.outer_end));
+                    rebind_outer();
+                    auto inner_range_new = borrow(*std::ranges::prev(it.outer_end));
+
+                    it.inner_begin =
+                      tag_invoke(custom::rebind_iterator_tag{}, it.inner_begin, inner_range_old, inner_range_new);
+                    it.inner_it =
+                      tag_invoke(custom::rebind_iterator_tag{}, it.inner_it, inner_range_old, inner_range_new);
+                    it.inner_end =
+                      tag_invoke(custom::rebind_iterator_tag{}, it.inner_end, inner_range_old, inner_range_new);
+                    return it;
+                }
+            }
+
+            rebind_outer();
+            return it;
+        }
 
+        auto inner_range_old = borrow(*it.outer_it);
+        rebind_outer();
         auto inner_range_new = borrow(*it.outer_it);
-        if constexpr (bidi)
+        if constexpr (store_begin)
             it.inner_begin =
               tag_invoke(custom::rebind_iterator_tag{}, it.inner_begin, inner_range_old, inner_range_new);
         it.inner_it  = tag_invoke(custom::rebind_iterator_tag{}, it.inner_it, inner_range_old, inner_range_new);
@@ -96,6 +148,106 @@ private:
         return it;
     }
 
+    /*!\brief Customisation for radr::subdivide that cuts the underlying (outer) range.
+     * \details
+     *
+     * The parts are balanced by the number of inner ranges, not by the number of elements. Parts that consist only
+     * of empty inner ranges are skipped.
+     */
+    template <borrowed_mp_range R>
+        requires(std::random_access_iterator<UIt> && std::same_as<UIt, USen>)
+    constexpr friend auto tag_invoke(custom::subdivide_tag,
+                                     R &&                      r,
+                                     join_rad_iterator const & b,
+                                     join_rad_iterator const & e,
+                                     size_t const              k)
+    {
+        using part_t = decltype(subborrow(r, b, e));
+        std::vector<part_t> parts;
+
+        if (b == e)
+            return parts;
+
+        size_t const m = static_cast<size_t>(e.outer_it - b.outer_it);
+        size_t const p = std::max<size_t>(1, std::min(k, m));
+        parts.reserve(p);
+
+        for (size_t i = 0; i < p; ++i)
+        {
+            UIt const ob = b.outer_it + m * i / p;
+            UIt const oe = b.outer_it + m * (i + 1) / p;
+
+            /* the first part starts at b (which can be inside an inner range), the last part ends at e */
+            join_rad_iterator pb = i == 0 ? b : join_rad_iterator{ob, ob, b.outer_end};
+            if (i + 1 == p)
+            {
+                if (pb != e)
+                    parts.push_back(subborrow(r, std::move(pb), e));
+            }
+            else
+            {
+                if (i > 0)
+                    pb = join_rad_iterator{ob, ob, oe};
+                pb.outer_end = oe;
+                join_rad_iterator pe{oe, ob, oe};
+
+                if (pb != pe)
+                    parts.push_back(subborrow(r, std::move(pb), std::move(pe)));
+            }
+        }
+
+        return parts;
+    }
+
+    /*!\brief Customisation for radr::for_each_segment that passes (the segments of) the inner ranges.
+     * \details
+     *
+     * The first and last segment are the parts of the inner ranges that b and e point into. Empty inner ranges are
+     * passed as empty segments.
+     */
+    template <borrowed_mp_range R, typename Fn, one_of<join_rad_iterator, std::default_sentinel_t> Sen>
+    constexpr friend void tag_invoke(custom::for_each_segment_tag,
+                                     R &&,
+                                     join_rad_iterator const & b,
+                                     Sen const &               e,
+                                     Fn &                      fn)
+    {
+        constexpr bool has_end = std::same_as<Sen, join_rad_iterator>;
+
+        UIt outer_it = b.outer_it;
+        if (outer_it == b.outer_end)
+            return;
+
+        /* first inner range starts at b */
+        {
+            auto inner = borrow(*outer_it);
+            if constexpr (has_end)
+            {
+                if (outer_it == e.outer_it)
+                {
+                    radr::for_each_segment(inner, b.inner_it, e.inner_it, fn);
+                    return;
+                }
+            }
+            radr::for_each_segment(inner, b.inner_it, b.inner_end, fn);
+        }
+
+        for (++outer_it; outer_it != b.outer_end; ++outer_it)
+        {
+            auto inner = borrow(*outer_it);
+            if constexpr (has_end)
+            {
+                /* last inner range ends at e (unless e is at the end) */
+                if (outer_it == e.outer_it)
+                {
+                    radr::for_each_segment(inner, radr::begin(inner), e.inner_it, fn);
+                    return;
+                }
+            }
+            radr::for_each_segment(inner, fn);
+        }
+    }
+
 public:
     /*!\name Associated types
      * \{
@@ -133,6 +285,7 @@ public:
                 --outer_back;
                 inner_it    = radr::end(*outer_back);
                 inner_begin = inner_it; // necessary to allow proper operator-- on sentinel
+                inner_end   = inner_it; // same state as when reaching the end via operator++
             }
         }
         update_inner();
@@ -183,30 +336,23 @@ public:
     constexpr join_rad_iterator & operator--()
         requires bidi
     {
-        if (inner_it == inner_begin)
+        if (outer_it == outer_end || inner_it == current_inner_begin())
         {
-            assert(outer_it != outer_begin);
-            --outer_it;
-
-            while (outer_it != outer_begin)
+            /* move to the previous non-empty inner range; there is one, because this is not the begin */
+            do
             {
-                auto tmp = borrow(*outer_it);
-                inner_it = radr::end(tmp);
-                --inner_it;
+                --outer_it;
+                auto tmp    = borrow(*outer_it);
                 inner_begin = radr::begin(tmp);
+                inner_it    = radr::begin(tmp);
                 inner_end   = radr::end(tmp);
-
-                // skip empty inner ranges
-                if (inner_it == inner_end)
-                    --outer_it;
-                else
-                    break;
             }
+            while (inner_it == inner_end);
+
+            inner_it = inner_end;
         }
-        else
-        {
-            --inner_it;
-        }
+
+        --inner_it;
         return *this;
     }
 
@@ -250,6 +396,179 @@ public:
     }
 };
 
+/*!\brief The size of inner ranges whose size is part of the type (std::array, std::span with static extent and
+ * C arrays); 0 for all other types.
+ */
+template <typename T>
+inline constexpr size_t join_static_extent = 0;
+
+template <typename T, size_t N>
+inline constexpr size_t join_static_extent<std::array<T, N>> = N;
+
+template <typename T, size_t N>
+inline constexpr size_t join_static_extent<std::span<T, N>> = N == std::dynamic_extent ? 0 : N;
+
+template <typename T, size_t N>
+inline constexpr size_t join_static_extent<T[N]> = N;
+
+/*!\brief Whether radr::join can create random-access iterators over the range, i.e. the outer range is random-access
+ * with sized sentinel, and all inner ranges have the same (non-zero) size known at compile-time.
+ */
+template <typename URange>
+concept join_random_access =
+  std::ranges::random_access_range<URange> && std::sized_sentinel_for<sentinel_t<URange>, iterator_t<URange>> &&
+  std::ranges::random_access_range<std::ranges::range_reference_t<URange>> &&
+  (join_static_extent<std::remove_cvref_t<std::ranges::range_reference_t<URange>>> > 0);
+
+/*!\brief The iterator of radr::join for random-access outer ranges whose inner ranges have static size N.
+ * \details
+ *
+ * The position is stored as (outer iterator, index in inner range), so this iterator is small, and it supports O(1)
+ * random-access operations (the division/modulo by N is done at compile-time).
+ */
+template <std::random_access_iterator UIt, size_t N>
+class join_ra_iterator
+{
+    static_assert(N > 0);
+
+    using InnerIt = radr::iterator_t<std::iter_reference_t<UIt>>;
+
+public:
+    using iterator_concept  = std::random_access_iterator_tag;
+    using iterator_category = std::conditional_t<std::is_lvalue_reference_v<std::iter_reference_t<InnerIt>>,
+                                                 std::random_access_iterator_tag,
+                                                 std::input_iterator_tag>;
+    using value_type        = std::iter_value_t<InnerIt>;
+    using difference_type   = std::common_type_t<std::iter_difference_t<UIt>, std::iter_difference_t<InnerIt>>;
+
+private:
+    static constexpr difference_type n_ = static_cast<difference_type>(N);
+
+    [[no_unique_address]] UIt outer_it{}; // position in underlying outer rng
+    difference_type           inner_i = 0; // position in inner rng, always in [0, N)
+
+    template <std::random_access_iterator UIt2, size_t N2>
+    friend class join_ra_iterator;
+
+    template <typename Container>
+    constexpr friend auto tag_invoke(custom::rebind_iterator_tag,
+                                     join_ra_iterator it,
+                                     Container &      container_old,
+                                     Container &      container_new)
+    {
+        it.outer_it = tag_invoke(custom::rebind_iterator_tag{}, it.outer_it, container_old, container_new);
+        return it;
+    }
+
+public:
+    constexpr join_ra_iterator() = default;
+
+    constexpr join_ra_iterator(UIt uit, difference_type const i = 0) : outer_it{std::move(uit)}, inner_i{i} {}
+
+    //!\brief Construct from compatible iterator, in particular non-const to const.
+    template <detail::different_from<UIt> UIt2>
+        requires std::convertible_to<UIt2, UIt>
+    constexpr join_ra_iterator(join_ra_iterator<UIt2, N> i) : outer_it{std::move(i.outer_it)}, inner_i{i.inner_i}
+    {}
+
+    constexpr decltype(auto) operator*() const { return radr::begin(*outer_it)[inner_i]; }
+
+    constexpr decltype(auto) operator[](difference_type const n) const { return *(*this + n); }
+
+    constexpr join_ra_iterator & operator++()
+    {
+        if (++inner_i == n_)
+        {
+            ++outer_it;
+            inner_i = 0;
+        }
+        return *this;
+    }
+
+    constexpr join_ra_iterator operator++(int)
+    {
+        auto tmp = *this;
+        ++*this;
+        return tmp;
+    }
+
+    constexpr join_ra_iterator & operator--()
+    {
+        if (inner_i == 0)
+        {
+            --outer_it;
+            inner_i = n_;
+        }
+        --inner_i;
+        return *this;
+    }
+
+    constexpr join_ra_iterator operator--(int)
+    {
+        auto tmp = *this;
+        --*this;
+        return tmp;
+    }
+
+    constexpr join_ra_iterator & operator+=(difference_type const n)
+    {
+        difference_type const pos = inner_i + n;
+        difference_type       q   = pos / n_;
+        difference_type       r   = pos % n_;
+        if (r < 0)
+        {
+            r += n_;
+            --q;
+        }
+        outer_it += static_cast<std::iter_difference_t<UIt>>(q);
+        inner_i = r;
+        return *this;
+    }
+
+    constexpr join_ra_iterator & operator-=(difference_type const n) { return *this += -n; }
+
+    friend constexpr bool operator==(join_ra_iterator const & x, join_ra_iterator const & y)
+    {
+        return x.outer_it == y.outer_it && x.inner_i == y.inner_i;
+    }
+
+    friend constexpr bool operator<(join_ra_iterator const & x, join_ra_iterator const & y)
+    {
+        return x.outer_it < y.outer_it || (x.outer_it == y.outer_it && x.inner_i < y.inner_i);
+    }
+
+    friend constexpr bool operator>(join_ra_iterator const & x, join_ra_iterator const & y) { return y < x; }
+
+    friend constexpr bool operator<=(join_ra_iterator const & x, join_ra_iterator const & y) { return !(y < x); }
+
+    friend constexpr bool operator>=(join_ra_iterator const & x, join_ra_iterator const & y) { return !(x < y); }
+
+    friend constexpr auto operator<=>(join_ra_iterator const & x, join_ra_iterator const & y)
+        requires std::three_way_comparable<UIt>
+    {
+        if (auto const c = x.outer_it <=> y.outer_it; c != 0)
+            return c;
+        return static_cast<std::compare_three_way_result_t<UIt>>(x.inner_i <=> y.inner_i);
+    }
+
+    friend constexpr join_ra_iterator operator+(join_ra_iterator i, difference_type const n) { return i += n; }
+
+    friend constexpr join_ra_iterator operator+(difference_type const n, join_ra_iterator i) { return i += n; }
+
+    friend constexpr join_ra_iterator operator-(join_ra_iterator i, difference_type const n) { return i -= n; }
+
+    friend constexpr difference_type operator-(join_ra_iterator const & x, join_ra_iterator const & y)
+    {
+        return static_cast<difference_type>(x.outer_it - y.outer_it) * n_ + (x.inner_i - y.inner_i);
+    }
+
+    friend constexpr decltype(auto) iter_move(join_ra_iterator const & i) noexcept(
+      noexcept(std::ranges::iter_move(std::declval<InnerIt const &>())))
+    {
+        return std::ranges::iter_move(radr::begin(*i.outer_it) + i.inner_i);
+    }
+};
+
 inline constexpr auto join_borrow = []<borrowed_mp_range URange>(URange && urange)
     requires borrowed_mp_range<std::ranges::range_reference_t<URange>> &&
              std::semiregular<borrow_t<std::ranges::range_reference_t<URange>>>
@@ -260,7 +579,16 @@ inline constexpr auto join_borrow = []<borrowed_mp_range URange>(URange && urang
     using CSen = std::conditional_t<common_range<URange const>, CIt, std::default_sentinel_t>;
 
     //TODO only preserve common if underlying is bidi; this will make unidirectional iteration faster
-    if constexpr (common_range<URange>)
+    if constexpr (join_random_access<URange> && join_random_access<URange const>)
+    {
+        constexpr size_t N = join_static_extent<std::remove_cvref_t<std::ranges::range_reference_t<URange>>>;
+        using RIt          = join_ra_iterator<iterator_t<URange>, N>;
+        using CRIt         = join_ra_iterator<const_iterator_t<URange>, N>;
+
+        auto const b = radr::begin(urange);
+        return borrowing_rad<RIt, RIt, CRIt, CRIt>{RIt{b}, RIt{b + (radr::end(urange) - b)}};
+    }
+    else if constexpr (common_range<URange>)
         return borrowing_rad<It, Sen, CIt, CSen>{
           It{radr::begin(urange), radr::begin(urange), radr::end(urange)},
           It{  radr::end(urange), radr::begin(urange), radr::end(urange)}
@@ -282,12 +610,12 @@ inline constexpr auto join_coro = []<std::ranges::input_range URange>(URange &&
     using InnerRef = std::ranges::range_reference_t<Inner>;
     using InnerVal = std::ranges::range_value_t<Inner>;
 
-    return [](auto urange_) -> radr::generator<InnerRef, InnerVal>
+    return [](std::allocator_arg_t, frame_allocator_t, auto urange_) -> radr::generator<InnerRef, InnerVal>
     {
         for (auto && inner : urange_)
             for (auto && elem : inner)
                 co_yield elem;
-    }(std::move(urange));
+    }(std::allocator_arg, frame_allocator(), std::move(urange));
 };
 
 } // namespace radr::detail
@@ -318,12 +646,22 @@ inline namespace cpo
  *   * radr::constant_range
  *   * radr::mutable_range (see below)
  *
- * This range adaptor never models std::ranges::sized_range or radr::approximately_sized_range.
+ * If \p urange is a std::ranges::random_access_range with sized sentinel and its `range_reference_t` is a type with
+ * static size (std::array, std::span with static extent, C array), the multi-pass adaptor models
+ * std::ranges::random_access_range, std::ranges::sized_range and radr::common_range; e.g. a
+ * `std::vector<std::array<T, N>>` can be joined, indexed and sliced in O(1).
+ * Otherwise, this range adaptor never models std::ranges::sized_range or radr::approximately_sized_range.
  *
- * Note that the bidirectional adaptor's iterator is larger than that of the forward-only version (6 stored iterators VS
- * 4 stored iterators), so it may be beneficial to prefix the invocation like this
+ * If the inner ranges are contiguous and sized (e.g. `std::vector<std::string>`), the iterator stores only 4 iterators
+ * (outer position and end, inner position and end), also when it is bidirectional.
+ * Otherwise, the bidirectional adaptor's iterator is larger than that of the forward-only version (6 stored iterators
+ * VS 4 stored iterators), so it may be beneficial to prefix the invocation like this
  * `… | radr::to_uni | radr::join | …` if you don't need bidirectionality.
  *
+ * If it is not random-access, the iterator supports radr::for_each_segment, so radr::for_each, radr::fold and
+ * radr::copy run one loop per inner range; prefer these over a range-based for-loop in hot code.
+ * For random access into inner ranges with different sizes, see radr::join_indexed.
+ *
  * ### Single-pass adaptor
  *
  *  * Requirements on \p urange : std::ranges::input_range
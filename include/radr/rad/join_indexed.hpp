@@ -0,0 +1,345 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Copyright (c) 2023-2025 Hannes Hauswedell
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See the LICENSE file for details.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <ranges>
+#include <vector>
+
+#include "../concepts.hpp"
+#include "../custom/subborrow.hpp"
+#include "../detail/detail.hpp"
+#include "../range_access.hpp"
+#include "../rad_util/owning_rad.hpp"
+#include "../rad_util/shared_rad.hpp"
+
+namespace radr::detail
+{
+
+/*!\brief Whether radr::join_indexed can be applied to the (stored) range, i.e. it is random-access, and the inner
+ * ranges are random-access, sized and are either returned as lvalues or are borrowed ranges.
+ */
+template <typename URange>
+concept join_indexable =
+  std::ranges::random_access_range<URange> &&
+  std::ranges::random_access_range<std::ranges::range_reference_t<URange>> &&
+  std::ranges::sized_range<std::ranges::range_reference_t<URange>> &&
+  (std::is_lvalue_reference_v<std::ranges::range_reference_t<URange>> ||
+   std::ranges::borrowed_range<std::ranges::range_reference_t<URange>>);
+
+template <typename URange>
+class join_index;
+
+/*!\brief The iterator of radr::join_indexed.
+ * \details
+ *
+ * Stores a pointer to the radr::detail::join_index, the flattened position, the index of the current inner range and
+ * an iterator into the current inner range. Incrementing and decrementing are (amortised) O(1), other random-access
+ * operations are O(log n) in the number of inner ranges (binary search on the offsets).
+ */
+template <typename URange, bool Const>
+class join_indexed_iterator
+{
+    using Index   = maybe_const<Const, join_index<URange>>;
+    using InnerIt = radr::iterator_t<std::ranges::range_reference_t<maybe_const<Const, URange>>>;
+
+public:
+    using iterator_concept  = std::random_access_iterator_tag;
+    using iterator_category = std::conditional_t<std::is_lvalue_reference_v<std::iter_reference_t<InnerIt>>,
+                                                 std::random_access_iterator_tag,
+                                                 std::input_iterator_tag>;
+    using value_type        = std::iter_value_t<InnerIt>;
+    using difference_type   = std::ptrdiff_t;
+
+private:
+    Index *         index_ = nullptr;
+    InnerIt         inner_it{}; // position in current inner rng; value-initialised at the end
+    size_t          outer_i = 0; // index of current inner rng; never an empty one (number of inner rngs at the end)
+    difference_type pos     = 0; // position in the flattened range
+
+    template <typename URange2, bool Const2>
+    friend class join_indexed_iterator;
+
+    constexpr std::vector<size_t> const & offsets() const noexcept { return index_->offsets_; }
+
+    constexpr size_t n_inner() const noexcept { return offsets().size() - 1; }
+
+    //!\brief Set inner_it from outer_i and pos.
+    constexpr void update_inner()
+    {
+        if (outer_i < n_inner())
+        {
+            inner_it = radr::begin(radr::begin(index_->urange_)[outer_i]) +
+                       static_cast<std::iter_difference_t<InnerIt>>(size_t(pos) - offsets()[outer_i]);
+        }
+        else
+        {
+            inner_it = InnerIt{};
+        }
+    }
+
+    //!\brief Jump to the position p (binary search on the offsets).
+    constexpr void seek(difference_type const p)
+    {
+        pos = p;
+        // the last inner rng whose offset is <= p; empty inner rngs are skipped, because their offset is that of the
+        // following one
+        outer_i = static_cast<size_t>(std::ranges::upper_bound(offsets(), size_t(p)) - offsets().begin()) - 1;
+        update_inner();
+    }
+
+public:
+    constexpr join_indexed_iterator() = default;
+
+    constexpr join_indexed_iterator(Index & index, difference_type const p) : index_{&index} { seek(p); }
+
+    //!\brief Construct const iterator from non-const iterator.
+    constexpr join_indexed_iterator(join_indexed_iterator<URange, !Const> i)
+        requires(Const && std::convertible_to<typename join_indexed_iterator<URange, !Const>::InnerIt, InnerIt>)
+      : index_{i.index_}, inner_it{std::move(i.inner_it)}, outer_i{i.outer_i}, pos{i.pos}
+    {}
+
+    constexpr decltype(auto) operator*() const { return *inner_it; }
+
+    constexpr decltype(auto) operator[](difference_type const n) const { return *(*this + n); }
+
+    constexpr join_indexed_iterator & operator++()
+    {
+        ++pos;
+        ++inner_it;
+        if (size_t(pos) == offsets()[outer_i + 1])
+        {
+            while (++outer_i < n_inner() && offsets()[outer_i + 1] == size_t(pos))
+                ;
+            update_inner();
+        }
+        return *this;
+    }
+
+    constexpr join_indexed_iterator operator++(int)
+    {
+        auto tmp = *this;
+        ++*this;
+        return tmp;
+    }
+
+    constexpr join_indexed_iterator & operator--()
+    {
+        if (size_t(pos) == offsets()[outer_i])
+        {
+            --pos;
+            while (offsets()[outer_i] > size_t(pos))
+                --outer_i;
+            update_inner();
+        }
+        else
+        {
+            --pos;
+            --inner_it;
+        }
+        return *this;
+    }
+
+    constexpr join_indexed_iterator operator--(int)
+    {
+        auto tmp = *this;
+        --*this;
+        return tmp;
+    }
+
+    constexpr join_indexed_iterator & operator+=(difference_type const n)
+    {
+        difference_type const p = pos + n;
+        if (outer_i < n_inner() && size_t(p) >= offsets()[outer_i] && size_t(p) < offsets()[outer_i + 1])
+        {
+            pos = p;
+            inner_it += static_cast<std::iter_difference_t<InnerIt>>(n);
+        }
+        else
+        {
+            seek(p);
+        }
+        return *this;
+    }
+
+    constexpr join_indexed_iterator & operator-=(difference_type const n) { return *this += -n; }
+
+    friend constexpr bool operator==(join_indexed_iterator const & x, join_indexed_iterator const & y)
+    {
+        return x.pos == y.pos;
+    }
+
+    friend constexpr auto operator<=>(join_indexed_iterator const & x, join_indexed_iterator const & y)
+    {
+        return x.pos <=> y.pos;
+    }
+
+    friend constexpr join_indexed_iterator operator+(join_indexed_iterator i, difference_type const n)
+    {
+        return i += n;
+    }
+
+    friend constexpr join_indexed_iterator operator+(difference_type const n, join_indexed_iterator i)
+    {
+        return i += n;
+    }
+
+    friend constexpr join_indexed_iterator operator-(join_indexed_iterator i, difference_type const n)
+    {
+        return i -= n;
+    }
+
+    friend constexpr difference_type operator-(join_indexed_iterator const & x, join_indexed_iterator const & y)
+    {
+        return x.pos - y.pos;
+    }
+
+    friend constexpr decltype(auto) iter_move(join_indexed_iterator const & i) noexcept(
+      noexcept(std::ranges::iter_move(std::declval<InnerIt const &>())))
+    {
+        return std::ranges::iter_move(i.inner_it);
+    }
+
+    friend constexpr void iter_swap(join_indexed_iterator const & x, join_indexed_iterator const & y) noexcept(
+      noexcept(std::ranges::iter_swap(x.inner_it, y.inner_it)))
+        requires std::indirectly_swappable<InnerIt>
+    {
+        std::ranges::iter_swap(x.inner_it, y.inner_it);
+    }
+};
+
+/*!\brief The container that radr::join_indexed stores in a radr::owning_rad.
+ * \tparam URange The (borrowed or owned) outer range.
+ * \details
+ *
+ * Holds the outer range and the prefix sums of the inner ranges' sizes, i.e. offsets[i] is the position of the first
+ * element of the i-th inner range in the flattened range; the last element of offsets is the total size.
+ */
+template <typename URange>
+class join_index
+{
+    URange              urange_{};
+    std::vector<size_t> offsets_{0};
+
+    template <typename URange2, bool Const>
+    friend class join_indexed_iterator;
+
+public:
+    join_index()
+        requires std::default_initializable<URange>
+    = default;
+
+    constexpr explicit join_index(URange urange) : urange_(std::move(urange))
+    {
+        if constexpr (std::ranges::sized_range<URange>)
+            offsets_.reserve(std::ranges::size(urange_) + 1);
+
+        size_t sum = 0;
+        for (auto && inner : urange_)
+        {
+            sum += std::ranges::size(inner);
+            offsets_.push_back(sum);
+        }
+    }
+
+    constexpr auto begin() { return join_indexed_iterator<URange, false>{*this, 0}; }
+
+    constexpr auto begin() const { return join_indexed_iterator<URange, true>{*this, 0}; }
+
+    constexpr auto end() { return join_indexed_iterator<URange, false>{*this, std::ptrdiff_t(size())}; }
+
+    constexpr auto end() const { return join_indexed_iterator<URange, true>{*this, std::ptrdiff_t(size())}; }
+
+    constexpr size_t size() const noexcept { return offsets_.back(); }
+};
+
+inline constexpr auto join_indexed_make = []<typename URange>(URange urange)
+{
+    static_assert(join_indexable<URange> && join_indexable<URange const>,
+                  "radr::join_indexed requires a random-access range of random-access, sized ranges (that are "
+                  "either lvalues or borrowed ranges).");
+    return owning_rad{join_index<URange>{std::move(urange)}};
+};
+
+} // namespace radr::detail
+
+namespace radr
+{
+
+inline namespace cpo
+{
+/*!\brief Like radr::join, but builds an index on construction that allows random access.
+ * \param urange The underlying range.
+ * \details
+ *
+ * On construction, the sizes of all inner ranges are read and their prefix sums are stored (one `size_t` per inner
+ * range). This makes the returned range random-access and sized, even if the inner ranges have different sizes:
+ *
+ * ```cpp
+ * std::vector<std::vector<int>> vecs{{1, 2}, {}, {3, 4, 5}};
+ * auto r = std::ref(vecs) | radr::join_indexed;
+ * r[3];                            // 4
+ * r.size();                        // 5
+ * std::ref(r) | radr::slice(1, 4); // [2, 3, 4], O(log n)
+ * ```
+ *
+ * Random-access operations and creating subranges are O(log n) in the number of inner ranges; sequential iteration
+ * is (amortised) O(1) per element. Construction is O(n) and allocates; this is the price to pay compared to
+ * radr::join.
+ *
+ * The index is stored in a radr::owning_rad (also for borrowed input), so copying the returned range copies the
+ * index (and the underlying range if it is owned), but subranges of it (e.g. via radr::take or radr::slice) are
+ * borrowed ranges that are cheap to copy.
+ * The index is not updated if the sizes of the inner ranges change.
+ *
+ * ### Multi-pass adaptor
+ *
+ * * Requirements on \p urange : radr::mp_range, std::ranges::random_access_range
+ * * Requirements on the inner ranges: std::ranges::random_access_range, std::ranges::sized_range; lvalue references
+ *   or std::ranges::borrowed_range.
+ *
+ * The returned range is random-access, sized and common. It is never a std::ranges::borrowed_range.
+ *
+ * ### Single-pass adaptor
+ *
+ * Is ill-formed on single-pass ranges.
+ */
+inline constexpr auto join_indexed = detail::range_adaptor_closure_t{detail::overloaded{
+  []<std::ranges::forward_range URange>(URange && urange)
+{
+    static_assert(mp_range<URange>, RADR_ASSERTSTRING_CONST_ITERABLE);
+
+    /* borrowed ranges are stored as borrowed ranges; but they need to be semiregular */
+    if constexpr (std::ranges::borrowed_range<std::remove_reference_t<URange>> &&
+                  !std::semiregular<std::remove_cvref_t<URange>>)
+    {
+        return detail::join_indexed_make(radr::borrow(urange));
+    }
+    else /* other ranges are stored by value (containers are moved) */
+    {
+        if constexpr (!std::ranges::borrowed_range<std::remove_reference_t<URange>> &&
+                      !detail::is_shared_rad<std::remove_cvref_t<URange>>)
+        {
+            static_assert(!std::is_lvalue_reference_v<URange>, RADR_ASSERTSTRING_RVALUE);
+            static_assert(std::copyable<URange>, RADR_ASSERTSTRING_COPYABLE);
+        }
+        return detail::join_indexed_make(std::remove_cvref_t<URange>(std::forward<URange>(urange)));
+    }
+},
+  //!\brief std::reference_wrapper -> unpacked and fwd'ed as borrowed range
+  []<std::ranges::forward_range URange>(std::reference_wrapper<URange> const & urange)
+{ return detail::join_indexed_make(radr::borrow(static_cast<URange &>(urange))); }}};
+} // namespace cpo
+} // namespace radr
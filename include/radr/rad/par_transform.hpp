@@ -0,0 +1,178 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Copyright (c) 2023-2025 Hannes Hauswedell
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See the LICENSE file for details.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <ranges>
+
+#include "../concepts.hpp"
+#include "../detail/detail.hpp"
+#include "../detail/pipe.hpp"
+#include "../detail/thread_pool.hpp"
+#include "../frame_resource.hpp"
+#include "../generator.hpp"
+#include "../range_access.hpp"
+
+namespace radr::detail
+{
+
+//!\brief An element of the reorder window of radr::par_transform.
+template <typename In, typename Out>
+struct par_transform_slot
+{
+    std::optional<In>  in;
+    std::optional<Out> out;
+    std::exception_ptr error{};
+    bool               ready = false; // guarded by the mutex of the window
+};
+
+inline constexpr auto par_transform_coro = []<std::ranges::input_range URange, typename Fn>(URange &&   urange,
+                                                                                           Fn          fn,
+                                                                                           std::size_t threads = 0,
+                                                                                           std::size_t window  = 0)
+{
+    static_assert(!std::is_lvalue_reference_v<URange>, RADR_ASSERTSTRING_RVALUE);
+    static_assert(std::movable<URange>, RADR_ASSERTSTRING_MOVABLE);
+
+    using in_t = std::ranges::range_value_t<URange>;
+    static_assert(std::constructible_from<in_t, std::ranges::range_reference_t<URange>>,
+                  "The elements of the range must be convertible to its value_type.");
+    static_assert(std::move_constructible<Fn> && std::invocable<Fn const &, in_t &>,
+                  "The constraints for radr::par_transform's functor are not met.");
+    using out_t = std::remove_cvref_t<std::invoke_result_t<Fn const &, in_t &>>;
+    static_assert(!std::is_void_v<out_t>, "The functor passed to radr::par_transform must return a value.");
+
+    if (threads == 0)
+        threads = default_thread_count();
+    if (window == 0)
+        window = 2 * threads;
+
+    return [](std::allocator_arg_t,
+              frame_allocator_t,
+              auto              urange_,
+              Fn const          fn_,
+              std::size_t const threads_,
+              std::size_t const window_) -> radr::generator<out_t &, out_t>
+    {
+        using slot_t = par_transform_slot<in_t, out_t>;
+
+        std::unique_ptr<slot_t[]> slots{new slot_t[window_]};
+        std::mutex                mtx;
+        std::condition_variable   cv;
+
+        /* destroyed first, i.e. all running jobs are finished before the slots are destroyed */
+        thread_pool pool{threads_,
+                         [&](std::size_t const i)
+                         {
+                             slot_t & slot = slots[i % window_];
+                             try
+                             {
+                                 slot.out.emplace(std::invoke(fn_, *slot.in));
+                             }
+                             catch (...)
+                             {
+                                 slot.error = std::current_exception();
+                             }
+
+                             {
+                                 std::lock_guard lock{mtx};
+                                 slot.ready = true;
+                             }
+                             cv.notify_one();
+                         }};
+
+        auto        it       = radr::begin(urange_);
+        auto        e        = radr::end(urange_);
+        std::size_t next_in  = 0; // number of elements submitted
+        std::size_t next_out = 0; // number of elements returned
+
+        while (true)
+        {
+            /* fill the window */
+            for (; next_in - next_out < window_ && it != e; ++next_in)
+            {
+                slots[next_in % window_].in.emplace(*it);
+                ++it;
+                pool.submit(next_in);
+            }
+
+            if (next_out == next_in)
+                co_return;
+
+            slot_t & slot = slots[next_out % window_];
+            {
+                std::unique_lock lock{mtx};
+                cv.wait(lock, [&] { return slot.ready; });
+            }
+
+            if (slot.error)
+                std::rethrow_exception(slot.error);
+
+            co_yield *slot.out;
+
+            slot.in.reset();
+            slot.out.reset();
+            slot.ready = false;
+            ++next_out;
+        }
+    }(std::allocator_arg, frame_allocator(), std::move(urange), std::move(fn), threads, window);
+};
+
+} // namespace radr::detail
+
+namespace radr
+{
+
+inline namespace cpo
+{
+
+/*!\brief Like radr::transform, but the invocable is applied on multiple threads; the order is preserved.
+ * \param urange The underlying range.
+ * \param fn The invocable to apply.
+ * \param threads The number of worker threads; 0 (the default) means std::thread::hardware_concurrency().
+ * \param window The maximum number of elements in flight; 0 (the default) means `2 * threads`.
+ * \details
+ *
+ * This is a single-pass adaptor. Elements are read from \p urange (on the calling thread) and copied into a window
+ * of \p window slots. For each slot, \p fn is invoked by one of the worker threads. The results are returned in the
+ * order of the input; if the next result is not ready yet, the consumer waits. Reading of further elements is
+ * blocked while the window is full, so memory use is bounded even if one element takes very long.
+ *
+ * ```cpp
+ * for (auto & record : radr::istream<record_t>(file) | radr::par_transform(expensive_fn))
+ *     ...;
+ * ```
+ *
+ * This only pays off if \p fn is expensive compared to the synchronisation (a mutex lock per element and a context
+ * switch if the consumer has to wait). Elements are stored as `std::ranges::range_value_t<URange>`, so this is not
+ * suitable for ranges whose elements refer to a buffer that is reused (like the std::span of radr::batch).
+ *
+ * \p fn is called concurrently (as const) from multiple threads, so it must not have unsynchronised side effects. If
+ * \p fn throws, the exception is rethrown when the consumer reaches the respective element. The worker threads are
+ * started when iteration begins and are stopped when the range is destroyed.
+ *
+ * Requirements:
+ *   * `std::ranges::input_range<URange>`
+ *   * \p urange must be an rvalue.
+ *   * \p fn is std::move_constructible and std::invocable with `std::ranges::range_value_t<URange> &` and does not
+ *     return void.
+ */
+inline constexpr auto par_transform = detail::pipe_with_args_fn<decltype(detail::par_transform_coro), void>{};
+
+} // namespace cpo
+} // namespace radr
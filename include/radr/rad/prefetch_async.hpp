@@ -0,0 +1,241 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Copyright (c) 2023-2025 Hannes Hauswedell
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See the LICENSE file for details.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <optional>
+#include <ranges>
+#include <thread>
+#include <vector>
+
+#include "../concepts.hpp"
+#include "../detail/detail.hpp"
+#include "../detail/pipe.hpp"
+#include "../frame_resource.hpp"
+#include "../generator.hpp"
+#include "../range_access.hpp"
+
+namespace radr::detail
+{
+
+/*!\brief Values that refer to a buffer of the producer, like the std::string_view of radr::lines or the std::span of
+ * radr::batch; these are deep-copied into the ring.
+ */
+template <typename Val>
+concept prefetch_deep_copy =
+  std::ranges::view<Val> && std::ranges::borrowed_range<Val> && std::ranges::contiguous_range<Val> &&
+  std::ranges::sized_range<Val> &&
+  std::constructible_from<Val, std::ranges::range_value_t<Val> *, std::ranges::range_size_t<Val>>;
+
+//!\brief A slot in the ring of radr::prefetch_async that holds one element.
+template <typename Val>
+struct prefetch_slot
+{
+    std::optional<Val> val;
+
+    template <typename Ref>
+    void store(Ref && ref)
+    {
+        val.emplace(std::forward<Ref>(ref));
+    }
+
+    Val & get() noexcept { return *val; }
+
+    void release() noexcept { val.reset(); }
+};
+
+//!\brief A slot in the ring of radr::prefetch_async that holds a copy of the elements of a batch or string_view.
+template <prefetch_deep_copy Val>
+struct prefetch_slot<Val>
+{
+    std::vector<std::ranges::range_value_t<Val>> buffer; // keeps its capacity when the slot is reused
+
+    template <typename Ref>
+    void store(Ref && ref)
+    {
+        buffer.assign(std::ranges::begin(ref), std::ranges::end(ref));
+    }
+
+    Val get() noexcept { return Val{buffer.data(), buffer.size()}; }
+
+    void release() noexcept {}
+};
+
+/*!\brief The state shared between the consumer (the coroutine) and the producer thread of radr::prefetch_async.
+ * \details
+ *
+ * This is a bounded single-producer/single-consumer ring. `head` and `tail` are the number of elements consumed and
+ * produced, shifted left by one; the lowest bit of `tail` signals the end of input and the lowest bit of `head`
+ * signals that the consumer stopped. Both sides wait via std::atomic::wait() when the ring is empty/full.
+ */
+template <typename URange>
+struct prefetch_state
+{
+    using slot_t = prefetch_slot<std::ranges::range_value_t<URange>>;
+
+    std::size_t const         n;
+    std::unique_ptr<slot_t[]> ring;
+    std::atomic<std::size_t>  head{0};
+    std::atomic<std::size_t>  tail{0};
+    std::exception_ptr        error{};
+    std::thread               thread{};
+
+    explicit prefetch_state(std::size_t const n_) : n{n_}, ring{new slot_t[n_]} {}
+
+    prefetch_state(prefetch_state const &)             = delete;
+    prefetch_state & operator=(prefetch_state const &) = delete;
+
+    ~prefetch_state()
+    {
+        if (thread.joinable())
+        {
+            head.fetch_or(1, std::memory_order_release);
+            head.notify_one();
+            thread.join();
+        }
+    }
+
+    void produce(URange & urange) noexcept
+    {
+        std::size_t t = 0;
+        try
+        {
+            auto it = radr::begin(urange);
+            auto e  = radr::end(urange);
+            for (; it != e; ++it)
+            {
+                std::size_t h = head.load(std::memory_order_acquire);
+                while (t - (h >> 1) == n && !(h & 1))
+                {
+                    head.wait(h, std::memory_order_acquire);
+                    h = head.load(std::memory_order_acquire);
+                }
+
+                if (h & 1) // consumer has stopped
+                    return;
+
+                ring[t % n].store(*it);
+                ++t;
+                tail.store(t << 1, std::memory_order_release);
+                tail.notify_one();
+            }
+        }
+        catch (...)
+        {
+            error = std::current_exception();
+        }
+
+        tail.store((t << 1) | 1, std::memory_order_release);
+        tail.notify_one();
+    }
+};
+
+inline constexpr auto prefetch_async_coro = []<std::ranges::input_range URange>(URange && urange, std::size_t const n)
+{
+    static_assert(!std::is_lvalue_reference_v<URange>, RADR_ASSERTSTRING_RVALUE);
+    static_assert(std::movable<URange>, RADR_ASSERTSTRING_MOVABLE);
+
+    using state_t = prefetch_state<std::remove_cvref_t<URange>>;
+    using val_t   = std::ranges::range_value_t<URange>;
+    using ref_t   = decltype(std::declval<typename state_t::slot_t &>().get());
+    static_assert(std::constructible_from<val_t, std::ranges::range_reference_t<URange>>,
+                  "The elements of the range must be convertible to its value_type.");
+
+    assert(n > 0);
+
+    return [](std::allocator_arg_t, frame_allocator_t, auto urange_, std::size_t const n)
+             -> radr::generator<ref_t, val_t>
+    {
+        /* destroyed before urange_, which stops and joins the producer */
+        state_t state{n};
+        state.thread = std::thread{[&]() { state.produce(urange_); }};
+
+        std::size_t h = 0;
+        while (true)
+        {
+            std::size_t t = state.tail.load(std::memory_order_acquire);
+            while ((t >> 1) == h)
+            {
+                if (t & 1) // end of input
+                {
+                    if (state.error)
+                        std::rethrow_exception(state.error);
+                    co_return;
+                }
+
+                state.tail.wait(t, std::memory_order_acquire);
+                t = state.tail.load(std::memory_order_acquire);
+            }
+
+            typename state_t::slot_t & slot = state.ring[h % n];
+            co_yield slot.get();
+            slot.release();
+
+            ++h;
+            state.head.store(h << 1, std::memory_order_release);
+            state.head.notify_one();
+        }
+    }(std::allocator_arg, frame_allocator(), std::move(urange), n);
+};
+
+} // namespace radr::detail
+
+namespace radr
+{
+
+inline namespace cpo
+{
+
+/*!\brief Iterates the underlying range on a separate thread and buffers up to `n` elements ahead.
+ * \param urange The underlying range.
+ * \param n The capacity of the buffer (number of elements).
+ * \details
+ *
+ * This is a single-pass adaptor. When iteration begins, a thread is started that iterates over \p urange and stores
+ * copies of the elements in a bounded single-producer/single-consumer ring buffer; iterating over the returned range
+ * consumes elements from that ring. This overlaps the work done by the underlying range (reading, decompressing,
+ * parsing, …) with the work done by the consumer (further adaptors and the loop body).
+ *
+ * ```cpp
+ * auto r = radr::parse<double>(file)
+ *        | radr::batch(4096)
+ *        | radr::prefetch_async(8)    // reading and parsing happen on another thread
+ *        | radr::batch_transform(fn);
+ * ```
+ *
+ * Elements are copied (or moved) into the ring; the range's reference type is an lvalue reference to the element
+ * in the ring. If the value type is a borrowed, contiguous view (like the std::string_view of radr::lines or the
+ * std::span of radr::batch), it is assumed to point into a buffer that the underlying range reuses; such elements are
+ * deep-copied, and the reference type is that view (pointing into the ring) instead.
+ * References and views are valid until the iterator is incremented.
+ *
+ * Prefetching single elements adds synchronisation cost per element; it is most effective with batches.
+ * Exceptions thrown while iterating over \p urange are rethrown when the consumer reaches the corresponding position.
+ * If the returned range is destroyed before the end, the thread is stopped at the next element and joined; this
+ * blocks if the underlying range is blocked (e.g. reading from a pipe).
+ *
+ * Requirements:
+ *   * `std::ranges::input_range<URange>`
+ *   * \p urange must be an rvalue.
+ *   * `n > 0`
+ *
+ * The underlying range is created on the calling thread, iterated on the new thread, and destroyed on the calling
+ * thread, i.e. it must not depend on thread-local state during iteration.
+ */
+inline constexpr auto prefetch_async = detail::pipe_with_args_fn<decltype(detail::prefetch_async_coro), void>{};
+
+} // namespace cpo
+} // namespace radr
@@ -0,0 +1,69 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Copyright (c) 2023-2025 Hannes Hauswedell
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See the LICENSE file for details.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include <ranges>
+
+#include "../concepts.hpp"
+#include "../detail/detail.hpp"
+#include "../detail/pipe.hpp"
+#include "../rad_util/shared_rad.hpp"
+
+namespace radr
+{
+
+inline namespace cpo
+{
+/*!\brief Moves a container into reference-counted, immutable storage.
+ * \param urange The underlying range.
+ *
+ * Returns a radr::shared_rad that can be copied in O(1), i.e. without copying the container or rebinding
+ * iterators (as is necessary for radr::owning_rad). All adaptors applied to the result (on lvalues or rvalues)
+ * return radr::shared_rad again and refer to the same container:
+ *
+ * ```cpp
+ * auto shared = std::list{1, 2, 3, 4, 5} | radr::share;
+ * auto a      = shared | radr::take(2);             // no copy of the list
+ * auto b      = shared | radr::filter(is_odd);      // no copy of the list
+ * ```
+ *
+ * The elements of the returned range are constant.
+ *
+ * ### Multi-pass adaptor
+ *
+ * * Requirements on \p urange : radr::mp_range, std::copyable, rvalue.
+ *
+ * Preserves all range concepts except radr::mutable_range.
+ * If \p urange is already a radr::shared_rad, it is returned as-is.
+ *
+ * ### Single-pass adaptor
+ *
+ * Is ill-formed on single-pass ranges.
+ *
+ */
+inline constexpr auto share = detail::range_adaptor_closure_t{
+  []<std::ranges::forward_range URange>(URange && urange)
+{
+    if constexpr (detail::is_shared_rad<std::remove_cvref_t<URange>>)
+    {
+        return std::remove_cvref_t<URange>(std::forward<URange>(urange));
+    }
+    else
+    {
+        static_assert(mp_range<URange>, RADR_ASSERTSTRING_CONST_ITERABLE);
+        static_assert(!std::is_lvalue_reference_v<URange>, RADR_ASSERTSTRING_RVALUE);
+        static_assert(std::copyable<URange>, RADR_ASSERTSTRING_COPYABLE);
+        return shared_rad{std::move(urange)};
+    }
+}};
+} // namespace cpo
+} // namespace radr
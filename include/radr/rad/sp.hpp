@@ -0,0 +1,205 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Copyright (c) 2023-2025 Hannes Hauswedell
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See the LICENSE file for details.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <ranges>
+
+#include "../concepts.hpp"
+#include "../detail/detail.hpp"
+#include "../detail/pipe.hpp"
+#include "../rad_util/single_pass_rad.hpp"
+
+namespace radr::detail
+{
+
+//=============================================================================
+// policies
+//=============================================================================
+
+struct take_sp_policy : sp_policy_base
+{
+    std::size_t n = 0;
+
+    constexpr bool at_end(auto const & it, auto const & e) { return n == 0 || it == e; }
+
+    constexpr void next(auto & it, auto const &)
+    {
+        /* the underlying iterator is not incremented after the last element */
+        if (--n != 0)
+            ++it;
+    }
+};
+
+struct drop_sp_policy : sp_policy_base
+{
+    std::size_t n = 0;
+
+    constexpr void on_begin(auto & it, auto const & e) { std::ranges::advance(it, n, e); }
+};
+
+template <typename Fn>
+struct transform_sp_policy : sp_policy_base
+{
+    [[no_unique_address]] Fn fn;
+
+    template <typename UIt>
+    using value_t = std::remove_cvref_t<std::invoke_result_t<Fn &, std::iter_reference_t<UIt>>>;
+
+    constexpr decltype(auto) deref(auto const & it) { return std::invoke(fn, *it); }
+};
+
+template <typename Fn>
+struct filter_sp_policy : sp_policy_base
+{
+    [[no_unique_address]] Fn fn;
+
+    constexpr void on_begin(auto & it, auto const & e)
+    {
+        while (it != e && !std::invoke(fn, *it))
+            ++it;
+    }
+
+    constexpr void next(auto & it, auto const & e)
+    {
+        ++it;
+        on_begin(it, e);
+    }
+};
+
+template <typename Fn>
+struct take_while_sp_policy : sp_policy_base
+{
+    [[no_unique_address]] Fn fn;
+
+    constexpr bool at_end(auto const & it, auto const & e) { return it == e || !std::invoke(fn, *it); }
+};
+
+template <typename Fn>
+struct drop_while_sp_policy : sp_policy_base
+{
+    [[no_unique_address]] Fn fn;
+
+    constexpr void on_begin(auto & it, auto const & e)
+    {
+        while (it != e && std::invoke(fn, *it))
+            ++it;
+    }
+};
+
+struct as_rvalue_sp_policy : sp_policy_base
+{
+    constexpr decltype(auto) deref(auto const & it) { return std::ranges::iter_move(it); }
+};
+
+//=============================================================================
+// functors
+//=============================================================================
+
+template <typename URange, typename Policy>
+constexpr auto make_single_pass_rad(URange && urange, Policy policy)
+{
+    static_assert(!std::is_lvalue_reference_v<URange>, RADR_ASSERTSTRING_RVALUE);
+    static_assert(std::movable<URange>, RADR_ASSERTSTRING_MOVABLE);
+    return single_pass_rad<std::remove_cvref_t<URange>, Policy>{std::move(urange), std::move(policy)};
+}
+
+inline constexpr auto take_sp = []<std::ranges::input_range URange>(URange && urange, std::size_t const n)
+{
+    return make_single_pass_rad(std::forward<URange>(urange), take_sp_policy{{}, n});
+};
+
+inline constexpr auto drop_sp = []<std::ranges::input_range URange>(URange && urange, std::size_t const n)
+{
+    return make_single_pass_rad(std::forward<URange>(urange), drop_sp_policy{{}, n});
+};
+
+inline constexpr auto transform_sp = []<std::ranges::input_range URange, typename Fn>(URange && urange, Fn fn)
+{
+    static_assert(std::move_constructible<Fn> && std::invocable<Fn &, std::ranges::range_reference_t<URange>>,
+                  "The constraints for radr::sp::transform's functor are not met.");
+    static_assert(can_reference<std::invoke_result_t<Fn &, std::ranges::range_reference_t<URange>>>,
+                  "The constraints for radr::sp::transform's functor are not met.");
+
+    return make_single_pass_rad(std::forward<URange>(urange), transform_sp_policy<Fn>{{}, std::move(fn)});
+};
+
+inline constexpr auto filter_sp = []<std::ranges::input_range URange, typename Fn>(URange && urange, Fn fn)
+{
+    static_assert(weak_indirect_unary_invocable<Fn, std::ranges::iterator_t<URange>>,
+                  "The constraints for radr::sp::filter's functor are not satisfied.");
+
+    return make_single_pass_rad(std::forward<URange>(urange), filter_sp_policy<Fn>{{}, std::move(fn)});
+};
+
+inline constexpr auto take_while_sp = []<std::ranges::input_range URange, typename Fn>(URange && urange, Fn fn)
+{
+    static_assert(weak_indirect_unary_invocable<Fn, std::ranges::iterator_t<URange>>,
+                  "The constraints for radr::sp::take_while's functor are not satisfied.");
+
+    return make_single_pass_rad(std::forward<URange>(urange), take_while_sp_policy<Fn>{{}, std::move(fn)});
+};
+
+inline constexpr auto drop_while_sp = []<std::ranges::input_range URange, typename Fn>(URange && urange, Fn fn)
+{
+    static_assert(weak_indirect_unary_invocable<Fn, std::ranges::iterator_t<URange>>,
+                  "The constraints for radr::sp::drop_while's functor are not satisfied.");
+
+    return make_single_pass_rad(std::forward<URange>(urange), drop_while_sp_policy<Fn>{{}, std::move(fn)});
+};
+
+inline constexpr auto as_rvalue_sp = []<std::ranges::input_range URange>(URange && urange)
+{
+    return make_single_pass_rad(std::forward<URange>(urange), as_rvalue_sp_policy{});
+};
+
+} // namespace radr::detail
+
+/*!\brief Single-pass adaptors that do not use coroutines.
+ * \details
+ *
+ * The adaptors in this namespace behave like their namesakes in radr:: when applied to single-pass ranges, but
+ * they return a radr::single_pass_rad instead of a radr::generator. This avoids allocating a coroutine frame per
+ * adaptor and resuming/suspending per element, at the cost of larger types and longer compile times.
+ *
+ * ```cpp
+ * auto r = radr::istream<int>(stream) | radr::sp::filter(fn) | radr::sp::transform(fn2) | radr::sp::take(10);
+ * ```
+ *
+ * Requirements on the underlying range:
+ *   * std::ranges::input_range
+ *   * must be an rvalue (it is moved into the adaptor)
+ *
+ * Forward ranges are accepted, too, but the result is always a single-pass, move-only range.
+ * Unlike radr::generator, the resulting range must not be moved after begin() was called.
+ */
+namespace radr::sp
+{
+
+//!\brief Single-pass version of radr::take without coroutines.
+inline constexpr auto take = detail::pipe_with_args_fn<decltype(detail::take_sp), void>{};
+//!\brief Single-pass version of radr::drop without coroutines.
+inline constexpr auto drop = detail::pipe_with_args_fn<decltype(detail::drop_sp), void>{};
+//!\brief Single-pass version of radr::transform without coroutines.
+inline constexpr auto transform = detail::pipe_with_args_fn<decltype(detail::transform_sp), void>{};
+//!\brief Single-pass version of radr::filter without coroutines.
+inline constexpr auto filter = detail::pipe_with_args_fn<decltype(detail::filter_sp), void>{};
+//!\brief Single-pass version of radr::take_while without coroutines.
+inline constexpr auto take_while = detail::pipe_with_args_fn<decltype(detail::take_while_sp), void>{};
+//!\brief Single-pass version of radr::drop_while without coroutines.
+inline constexpr auto drop_while = detail::pipe_with_args_fn<decltype(detail::drop_while_sp), void>{};
+//!\brief Single-pass version of radr::as_rvalue without coroutines.
+inline constexpr auto as_rvalue = detail::pipe_without_args_fn<decltype(detail::as_rvalue_sp), void>{};
+
+} // namespace radr::sp
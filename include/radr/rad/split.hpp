@@ -18,13 +18,67 @@
 #include "radr/custom/subborrow.hpp"
 #include "radr/detail/detail.hpp"
 #include "radr/detail/pipe.hpp"
+#include "radr/detail/simd_find.hpp"
 #include "radr/factory/single.hpp"
+#include "radr/frame_resource.hpp"
 #include "radr/rad/as_const.hpp"
 #include "radr/rad/to_single_pass.hpp"
 #include "radr/range_access.hpp"
 
 namespace radr::detail
 {
+/*!\brief Whether radr::split can search for the pattern via radr::detail::simd_find (patterns of size 1) or
+ * radr::detail::simd_search (contiguous patterns), i.e. the underlying range is a contiguous range of integers and
+ * the pattern has the same value type.
+ */
+template <typename UIt, typename USen, typename Pattern>
+concept split_simd_findable =
+  std::contiguous_iterator<UIt> && std::sized_sentinel_for<USen, UIt> && std::ranges::sized_range<Pattern> &&
+  simd_findable<std::iter_value_t<UIt>> && std::same_as<std::iter_value_t<UIt>, std::ranges::range_value_t<Pattern>>;
+
+/*!\brief Returns the first match of \p pattern in [b, e), or [e, e) if there is none.
+ * \details
+ *
+ * An empty pattern matches after the first element.
+ */
+template <std::forward_iterator UIt, std::sentinel_for<UIt> USen, borrowed_mp_range Pattern>
+constexpr std::ranges::subrange<UIt> split_find(UIt const b, USen const e, Pattern const & pattern)
+{
+    if constexpr (split_simd_findable<UIt, USen, Pattern>)
+    {
+        using T = std::iter_value_t<UIt>;
+
+        size_t const    n  = std::ranges::size(pattern);
+        T const * const pb = std::to_address(b);
+        T const * const pe = pb + (e - b);
+        T const *       m  = nullptr;
+
+        if (n == 1) // single element; search via memchr or SIMD
+        {
+            m = simd_find(pb, pe, static_cast<T>(*radr::begin(pattern)));
+        }
+        else if constexpr (std::ranges::contiguous_range<Pattern const>)
+        {
+            if (n > 1) // SIMD filter on first and last element
+                m = simd_search(pb, pe, std::ranges::data(pattern), std::ranges::data(pattern) + n);
+        }
+
+        if (m != nullptr)
+        {
+            UIt const match_b = b + (m - pb);
+            return {match_b, m == pe ? match_b : match_b + static_cast<std::iter_difference_t<UIt>>(n)};
+        }
+    }
+
+    auto [match_b, match_e] = std::ranges::search(std::ranges::subrange(b, e), pattern);
+    if (match_b != e && std::ranges::empty(pattern))
+    {
+        ++match_b;
+        ++match_e;
+    }
+    return {match_b, match_e};
+}
+
 template <borrowed_mp_range Borrow, borrowed_mp_range Pattern>
     requires std::indirectly_comparable<std::ranges::iterator_t<Borrow>,
                                         std::ranges::iterator_t<Pattern>,
@@ -46,12 +100,7 @@ private:
 
     constexpr void go_next()
     {
-        auto [match_b, match_e] = std::ranges::search(std::ranges::subrange(subrange_begin, uend), pattern);
-        if (match_b != uend && std::ranges::empty(pattern))
-        {
-            ++match_b;
-            ++match_e;
-        }
+        auto [match_b, match_e] = split_find(subrange_begin, uend, pattern);
 
         subrange_end      = match_b;
         pattern_match_end = match_e;
@@ -244,6 +293,110 @@ inline constexpr auto split_borrow = overloaded{
 }};
 // clang-format on
 
+//!\brief State of radr::split on single-pass ranges; lives in the frame of the outer generator.
+template <typename UIt, typename USen, typename Pattern>
+struct split_sp_state
+{
+    [[no_unique_address]] UIt     it;
+    [[no_unique_address]] USen    e;
+    [[no_unique_address]] Pattern pattern;
+
+    bool started        = false; // whether the current segment has been looked at
+    bool done           = false; // whether the current segment has been exhausted
+    bool trailing_empty = false; // whether the input ended with the pattern
+
+    //!\brief Check whether the current position terminates the segment (and skip the pattern if so).
+    constexpr void settle()
+    {
+        if (it == e)
+        {
+            done = true;
+        }
+        else if (*it == pattern)
+        {
+            ++it;
+            if (it == e)
+                trailing_empty = true;
+            done = true;
+        }
+    }
+
+    constexpr void start()
+    {
+        if (!started)
+        {
+            started = true;
+            settle();
+        }
+    }
+
+    //!\brief Skip the remainder of the current segment (if it was not consumed) and prepare for the next one.
+    constexpr void next_segment()
+    {
+        start();
+        while (!done)
+        {
+            ++it;
+            settle();
+        }
+        started = false;
+        done    = false;
+    }
+};
+
+/*!\brief The inner range of radr::split on single-pass ranges.
+ * \details
+ *
+ * This is a non-owning handle to the state in the outer range; all objects of this type obtained from the same outer
+ * range refer to the same underlying position. Advancing the outer range skips the rest of the current segment.
+ */
+template <typename State>
+class split_sp_inner
+{
+    State * state = nullptr;
+
+    class iterator
+    {
+        State * state = nullptr;
+
+    public:
+        using iterator_concept = std::input_iterator_tag;
+        using value_type       = std::iter_value_t<decltype(State::it)>;
+        using difference_type  = std::iter_difference_t<decltype(State::it)>;
+
+        constexpr iterator() = default;
+        constexpr explicit iterator(State * state_) : state{state_} {}
+
+        constexpr decltype(auto) operator*() const { return *state->it; }
+
+        constexpr iterator & operator++()
+        {
+            ++state->it;
+            state->settle();
+            return *this;
+        }
+
+        constexpr void operator++(int) { ++*this; }
+
+        friend constexpr bool operator==(iterator const & lhs, std::default_sentinel_t)
+        {
+            return lhs.state->done;
+        }
+    };
+
+public:
+    constexpr split_sp_inner() = default;
+    constexpr explicit split_sp_inner(State * state_) : state{state_} {}
+
+    constexpr iterator begin() const
+    {
+        state->start();
+        return iterator{state};
+    }
+
+    constexpr std::default_sentinel_t end() const noexcept { return std::default_sentinel; }
+};
+
 inline constexpr auto split_coro =
   []<std::ranges::input_range URange, typename Pattern>(URange && urange, Pattern pattern)
 {
@@ -252,50 +405,28 @@ inline constexpr auto split_coro =
     static_assert(std::equality_comparable_with<std::ranges::range_reference_t<URange>, Pattern>,
                   "The element type of the range needs to be comparable with the Pattern.");
 
-    using inner_gen_t = radr::generator<std::ranges::range_reference_t<URange>, std::ranges::range_value_t<URange>>;
+    using state_t = split_sp_state<std::ranges::iterator_t<URange>, std::ranges::sentinel_t<URange>, Pattern>;
+    using inner_t = split_sp_inner<state_t>;
 
-    return [](auto urange_, Pattern pattern_) -> radr::generator<inner_gen_t &>
+    // all segments share the state in this frame; no per-segment allocations
+    return [](std::allocator_arg_t, frame_allocator_t, auto urange_, Pattern pattern_) -> radr::generator<inner_t &>
     {
-        auto it = radr::begin(urange_);
-        auto e  = radr::end(urange_);
-
-        bool trailing_empty = false;
+        state_t state{radr::begin(urange_), radr::end(urange_), std::move(pattern_)};
+        inner_t inner{&state};
 
-        auto inner_functor = [&pattern_, &trailing_empty](auto & it_, auto & e_) -> inner_gen_t
+        while (state.it != state.e)
         {
-            while (it_ != e_)
-            {
-                if (*it_ == pattern_)
-                {
-                    ++it_;
-                    if (it_ == e_)
-                        trailing_empty = true;
-                    co_return;
-                }
-                else
-                {
-                    co_yield *it_;
-                    ++it_;
-                }
-            }
-        };
-
-        while (it != e)
-        {
-            auto tmp = inner_functor(it, e);
-            co_yield tmp;
+            co_yield inner;
+            state.next_segment();
         }
 
-        if (trailing_empty)
+        if (state.trailing_empty)
         {
-            auto empty_ = []() -> inner_gen_t
-            {
-                co_return;
-            }();
-
-            co_yield empty_;
+            state.started = true;
+            state.done    = true;
+            co_yield inner;
         }
-    }(std::move(urange), std::move(pattern));
+    }(std::allocator_arg, frame_allocator(), std::move(urange), std::move(pattern));
 };
 
 } // namespace radr::detail
@@ -355,6 +486,10 @@ inline namespace cpo
  * auto frst = *subs.begin(); // this is a string_view, too
  * ```
  *
+ * If the underlying range is a contiguous range of integers (including characters) and the pattern is a single element
+ * or a contiguous range, the pattern is searched via std::memchr or SIMD instructions (SSE2, AVX2 or NEON, whichever
+ * are enabled at compile-time). Define `RADR_NO_SIMD` to disable the latter.
+ *
  * ## Single-pass ranges
  *
  * The pattern must be delimiter element (rvalue or lvalue) comparable to the elements of the underlying range.
@@ -364,7 +499,9 @@ inline namespace cpo
  *   * `std::ranges::input_range<URange>`
  *   * `std::equality_comparable_with<std::ranges::range_reference_t<URange>, Pattern>`
  *
- * Both, the "outer range"-type and the "inner range"-type are a radr::generator.
+ * The "outer range"-type is a radr::generator. The "inner range"-type is a light-weight input range that refers to
+ * the state of the outer range, i.e. no allocations happen per segment. Advancing the outer iterator skips the
+ * remainder of the current segment.
  * This design is fully lazy; no read-ahead happens.
  *
  */
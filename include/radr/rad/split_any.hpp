@@ -0,0 +1,287 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Copyright (c) 2023-2025 Hannes Hauswedell
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See the LICENSE file for details.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <ranges>
+
+#include "radr/custom/subborrow.hpp"
+#include "radr/detail/detail.hpp"
+#include "radr/detail/pipe.hpp"
+#include "radr/detail/simd_find.hpp"
+#include "radr/rad/as_const.hpp"
+#include "radr/rad/split.hpp"
+#include "radr/range_access.hpp"
+
+namespace radr::detail
+{
+
+/*!\brief The iterator of radr::split_any.
+ * \tparam Borrow The underlying range (borrowed).
+ * \tparam Set Either radr::detail::byte_set or the (borrowed) range of delimiters.
+ */
+template <borrowed_mp_range Borrow, std::semiregular Set>
+class split_any_rad_iterator
+{
+private:
+    using UIt  = iterator_t<Borrow>;
+    using USen = sentinel_t<Borrow>;
+
+    [[no_unique_address]] Set  set{};             // the delimiters
+    [[no_unique_address]] USen uend{};            // end of the underlying range
+    [[no_unique_address]] UIt  subrange_begin{};  // begin of current subrange (in underlying)
+    [[no_unique_address]] UIt  subrange_end{};    // end of current subrange, i.e. position of delimiter (in underlying)
+    [[no_unique_address]] bool trailing_empty_ = false;
+
+    static constexpr bool contiguous_bytes =
+      std::same_as<Set, byte_set> && std::ranges::contiguous_range<Borrow> && std::sized_sentinel_for<USen, UIt>;
+
+    constexpr void go_next()
+    {
+        if constexpr (contiguous_bytes)
+        {
+            using T = std::ranges::range_value_t<Borrow>;
+
+            T const * const b = std::to_address(subrange_begin);
+            T const * const e = b + (uend - subrange_begin);
+            subrange_end      = subrange_begin + (simd_find_any(b, e, set) - b);
+        }
+        else if constexpr (std::same_as<Set, byte_set>)
+        {
+            auto is_delim = [this](auto const & c) { return set.contains(static_cast<uint8_t>(c)); };
+            subrange_end  = std::ranges::find_if(subrange_begin, uend, is_delim);
+        }
+        else
+        {
+            subrange_end = std::ranges::find_first_of(subrange_begin, uend, radr::begin(set), radr::end(set));
+        }
+    }
+
+    template <borrowed_mp_range Borrow2, std::semiregular Set2>
+    friend class split_any_rad_iterator;
+
+    template <typename Container>
+    constexpr friend split_any_rad_iterator tag_invoke(custom::rebind_iterator_tag,
+                                                       split_any_rad_iterator it,
+                                                       Container &            container_old,
+                                                       Container &            container_new)
+    {
+        it.uend           = tag_invoke(custom::rebind_iterator_tag{}, it.uend, container_old, container_new);
+        it.subrange_begin = tag_invoke(custom::rebind_iterator_tag{}, it.subrange_begin, container_old, container_new);
+        it.subrange_end   = tag_invoke(custom::rebind_iterator_tag{}, it.subrange_end, container_old, container_new);
+
+        return it;
+    }
+
+public:
+    /*!\name Associated types
+     * \{
+     */
+    using iterator_concept  = std::forward_iterator_tag;
+    using iterator_category = std::input_iterator_tag;
+    using value_type        = subborrow_t<Borrow, UIt, UIt>;
+    using difference_type   = std::ranges::range_difference_t<value_type>;
+    //!\}
+
+    /*!\name Constructors, destructor and assignments.
+     * \{
+     */
+    constexpr split_any_rad_iterator()                                           = default;
+    constexpr split_any_rad_iterator(split_any_rad_iterator const &)             = default;
+    constexpr split_any_rad_iterator(split_any_rad_iterator &&)                  = default;
+    constexpr split_any_rad_iterator & operator=(split_any_rad_iterator const &) = default;
+    constexpr split_any_rad_iterator & operator=(split_any_rad_iterator &&)      = default;
+
+    //!\brief Construct from values.
+    constexpr split_any_rad_iterator(Borrow urange_, Set set_) :
+      set{std::move(set_)}, uend{radr::end(urange_)}, subrange_begin{radr::begin(urange_)}
+    {
+        go_next();
+    }
+
+    //!\brief Construct from compatible iterator, in particular non-const to const.
+    template <different_from<Borrow> Borrow2, typename Set2>
+        requires(std::constructible_from<UIt, typename split_any_rad_iterator<Borrow2, Set2>::UIt> &&
+                 std::constructible_from<USen, typename split_any_rad_iterator<Borrow2, Set2>::USen> &&
+                 std::constructible_from<Set, Set2>)
+    constexpr split_any_rad_iterator(split_any_rad_iterator<Borrow2, Set2> mut_iter) :
+      set{std::move(mut_iter.set)},
+      uend{std::move(mut_iter.uend)},
+      subrange_begin{std::move(mut_iter.subrange_begin)},
+      subrange_end{std::move(mut_iter.subrange_end)},
+      trailing_empty_{mut_iter.trailing_empty_}
+    {}
+    //!\}
+
+    /*!\name Iterator operators
+     * \{
+     */
+    constexpr value_type operator*() const { return subborrow(Borrow{}, subrange_begin, subrange_end); }
+
+    constexpr split_any_rad_iterator & operator++()
+    {
+        subrange_begin = subrange_end;
+        if (subrange_begin != uend)
+        {
+            ++subrange_begin; // skip the delimiter
+            if (subrange_begin == uend)
+            {
+                trailing_empty_ = true;
+                subrange_end    = subrange_begin;
+            }
+            else
+            {
+                go_next();
+            }
+        }
+        else
+        {
+            trailing_empty_ = false;
+        }
+        return *this;
+    }
+
+    constexpr split_any_rad_iterator operator++(int)
+    {
+        auto tmp = *this;
+        ++*this;
+        return tmp;
+    }
+    //!\}
+
+    /*!\name Comparison operators
+     * \{
+     */
+    friend constexpr bool operator==(split_any_rad_iterator const & x, split_any_rad_iterator const & y)
+    {
+        return x.subrange_begin == y.subrange_begin && x.trailing_empty_ == y.trailing_empty_;
+    }
+
+    friend constexpr bool operator==(split_any_rad_iterator const & x, USen const & y)
+    {
+        return x.subrange_begin == y && !x.trailing_empty_;
+    }
+    //!\}
+};
+
+inline constexpr auto split_any_borrow_impl =
+  []<borrowed_mp_range URange, borrowed_mp_range Delims>(URange && urange, Delims && delims)
+{
+    auto borrow_ = radr::borrow(urange);
+    auto set_    = [&]()
+    {
+        using uval_t = std::ranges::range_value_t<URange>;
+        using dval_t = std::ranges::range_value_t<Delims>;
+
+        /* the table compares bytes; this is only equivalent to comparing values if the signedness is the same */
+        if constexpr (byte_like<uval_t> && byte_like<dval_t> && std::is_signed_v<uval_t> == std::is_signed_v<dval_t>)
+        {
+            byte_set s;
+            for (auto const d : delims)
+                s.insert(static_cast<uint8_t>(d));
+            return s;
+        }
+        else
+        {
+            return radr::detail::as_const_borrow(delims);
+        }
+    }();
+
+    auto it  = split_any_rad_iterator{borrow_, set_};
+    auto sen = radr::end(borrow_); // use the underlying range's sentinel as-is
+
+    using It   = decltype(it);
+    using Sen  = sentinel_t<URange>;
+    using CIt  = split_any_rad_iterator<borrow_t<std::remove_cvref_t<URange> const &>, decltype(set_)>;
+    using CSen = const_sentinel_t<URange>;
+
+    return borrowing_rad<It, Sen, CIt, CSen>{std::move(it), std::move(sen)};
+};
+
+// clang-format off
+inline constexpr auto split_any_borrow = overloaded{
+/* split by lvalue range */
+[]<borrowed_mp_range URange, typename Delims>(URange && urange, std::reference_wrapper<Delims> const & delims)
+    requires comparable_ranges<URange, Delims>
+{
+    return split_any_borrow_impl(std::forward<URange>(urange), static_cast<Delims &>(delims));
+},
+/* split by rvalue range */
+[]<borrowed_mp_range URange, typename Delims>(URange && urange, Delims const & delims)
+    requires comparable_ranges<URange, Delims>
+{
+    static_assert(borrowed_mp_range<std::remove_cvref_t<Delims>>,
+                  "The delimiters must be a const-iterable, borrowed range. "
+                  "Did you forgot to wrap it in std::ref or std::cref?");
+    return split_any_borrow_impl(std::forward<URange>(urange), delims);
+}};
+// clang-format on
+
+} // namespace radr::detail
+
+namespace radr
+{
+
+inline namespace cpo
+{
+
+/*!\brief radr::split_any(urange, delimiters)
+ * \tparam URange Type of \p urange.
+ * \tparam Delims Type of \p delimiters.
+ * \param urange The underlying range.
+ * \param delimiters A range of delimiter elements.
+ * \details
+ *
+ * Turns a range into a range-of-ranges, by splitting on every element that is equal to one of the delimiters.
+ * The delimiters are not included in the output. This is useful for tokenising:
+ *
+ * ```cpp
+ * auto tokens = "foo bar,bax;"sv | radr::split_any(" \t,;"sv); // ["foo", "bar", "bax", ""]
+ * ```
+ *
+ * The delimiters can be:
+ *   * a std::ref-wrapped lvalue of a range whose elements are comparable to the underlying range.
+ *   * an rvalue of a range whose elements are comparable to the underlying range (only if the delimiters are a
+ *     borrowed_mp_range, e.g. a std::string_view).
+ *
+ * If the elements of both ranges are characters (or other integral types of size 1) of the same signedness, the
+ * delimiters are stored in a 256-bit table in the iterator, so lookup is O(1) and does not depend on the number of
+ * delimiters. If the underlying range is contiguous, 16 or 32 elements are classified at once with byte shuffles
+ * (SSSE3, AVX2 or NEON, whichever are enabled at compile-time). Otherwise, the delimiters are searched via
+ * std::ranges::find_first_of.
+ *
+ * ## Multi-pass ranges
+ *
+ * Requirements:
+ *   * `radr::mp_range<URange>`
+ *   * for Delims, see above.
+ *
+ * The returned "outer range"-type models radr::mp_range and preserves std::ranges::borrowed_range.
+ * It is never bidirectional, common, sized or mutable.
+ *
+ * The returned "inner range"-type is created via the radr::subborrow customisation point, i.e. splitting a
+ * std::string_view results in std::string_views (see radr::split).
+ *
+ * Construction of the adaptor is in O(n), because the first inner range is searched on construction.
+ *
+ * ## Single-pass ranges
+ *
+ * Is ill-formed on single-pass ranges.
+ */
+inline constexpr auto split_any = detail::pipe_with_args_fn<void, decltype(detail::split_any_borrow)>{};
+
+} // namespace cpo
+} // namespace radr
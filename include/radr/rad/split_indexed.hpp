@@ -0,0 +1,425 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Copyright (c) 2023-2025 Hannes Hauswedell
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See the LICENSE file for details.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <span>
+#include <vector>
+
+#include "radr/algorithm/par.hpp"
+#include "radr/concepts.hpp"
+#include "radr/custom/subborrow.hpp"
+#include "radr/detail/bind_back.hpp"
+#include "radr/detail/detail.hpp"
+#include "radr/rad/as_const.hpp"
+#include "radr/rad/split.hpp"
+#include "radr/rad_util/owning_rad.hpp"
+#include "radr/range_access.hpp"
+
+namespace radr::detail
+{
+
+template <typename URange>
+class split_index;
+
+/*!\brief The iterator of radr::split_indexed.
+ * \details
+ *
+ * Stores a pointer to the radr::detail::split_index and the number of the segment. Dereferencing creates the segment
+ * via radr::subborrow.
+ */
+template <typename URange, bool Const>
+class split_indexed_iterator
+{
+    using Index = maybe_const<Const, split_index<URange>>;
+
+    Index *        index_ = nullptr;
+    std::ptrdiff_t i      = 0;
+
+    template <typename URange2, bool Const2>
+    friend class split_indexed_iterator;
+
+public:
+    using value_type        = decltype(std::declval<Index &>().segment(0));
+    using iterator_concept  = std::random_access_iterator_tag;
+    using iterator_category = std::input_iterator_tag;
+    using difference_type   = std::ptrdiff_t;
+
+    constexpr split_indexed_iterator() = default;
+
+    constexpr split_indexed_iterator(Index & index, difference_type const i_) : index_{&index}, i{i_} {}
+
+    //!\brief Construct const iterator from non-const iterator.
+    constexpr split_indexed_iterator(split_indexed_iterator<URange, !Const> it)
+        requires Const
+      : index_{it.index_}, i{it.i}
+    {}
+
+    constexpr value_type operator*() const { return index_->segment(static_cast<size_t>(i)); }
+
+    constexpr value_type operator[](difference_type const n) const
+    {
+        return index_->segment(static_cast<size_t>(i + n));
+    }
+
+    constexpr split_indexed_iterator & operator++()
+    {
+        ++i;
+        return *this;
+    }
+
+    constexpr split_indexed_iterator operator++(int)
+    {
+        auto tmp = *this;
+        ++i;
+        return tmp;
+    }
+
+    constexpr split_indexed_iterator & operator--()
+    {
+        --i;
+        return *this;
+    }
+
+    constexpr split_indexed_iterator operator--(int)
+    {
+        auto tmp = *this;
+        --i;
+        return tmp;
+    }
+
+    constexpr split_indexed_iterator & operator+=(difference_type const n)
+    {
+        i += n;
+        return *this;
+    }
+
+    constexpr split_indexed_iterator & operator-=(difference_type const n)
+    {
+        i -= n;
+        return *this;
+    }
+
+    friend constexpr bool operator==(split_indexed_iterator const & x, split_indexed_iterator const & y)
+    {
+        return x.i == y.i;
+    }
+
+    friend constexpr auto operator<=>(split_indexed_iterator const & x, split_indexed_iterator const & y)
+    {
+        return x.i <=> y.i;
+    }
+
+    friend constexpr split_indexed_iterator operator+(split_indexed_iterator it, difference_type const n)
+    {
+        return it += n;
+    }
+
+    friend constexpr split_indexed_iterator operator+(difference_type const n, split_indexed_iterator it)
+    {
+        return it += n;
+    }
+
+    friend constexpr split_indexed_iterator operator-(split_indexed_iterator it, difference_type const n)
+    {
+        return it -= n;
+    }
+
+    friend constexpr difference_type operator-(split_indexed_iterator const & x, split_indexed_iterator const & y)
+    {
+        return x.i - y.i;
+    }
+};
+
+//!\brief The minimum number of elements per thread for radr::split_indexed to scan in parallel.
+inline constexpr size_t split_indexed_min_par_size = size_t{1} << 16;
+
+/*!\brief The container that radr::split_indexed stores in a radr::owning_rad.
+ * \tparam URange The (borrowed or owned) underlying range.
+ * \details
+ *
+ * Holds the underlying range and the positions where the pattern matches. The i-th segment ends where the i-th match
+ * begins and begins where the (i-1)-th match ends; the matches are the same as those found by radr::split.
+ */
+template <typename URange>
+class split_index
+{
+    URange              urange_{};
+    std::vector<size_t> matches_{};       // begin positions of the matches
+    size_t              pattern_size_ = 0;
+    size_t              size_         = 0; // the number of segments
+
+    template <typename URange2, bool Const>
+    friend class split_indexed_iterator;
+
+    static constexpr size_t npos = static_cast<size_t>(-1);
+
+    //!\brief The begin position of the first match that begins in [pos, limit), or npos.
+    template <typename Pattern>
+    constexpr size_t find_next(Pattern const & pattern, size_t const pos, size_t const limit) const
+    {
+        using diff_t = std::ranges::range_difference_t<URange const>;
+
+        size_t const n          = std::ranges::size(urange_);
+        size_t const region_end = pattern_size_ == 0 ? n : std::min(n, limit + pattern_size_ - 1);
+        auto const   ub         = radr::begin(urange_);
+
+        auto const   match = split_find(ub + static_cast<diff_t>(pos), ub + static_cast<diff_t>(region_end), pattern);
+        size_t const mb    = static_cast<size_t>(match.begin() - ub);
+        return mb == region_end || mb >= limit ? npos : mb;
+    }
+
+    //!\brief Append the begin positions of the (greedy) matches that begin in [pos, limit) to \p out.
+    template <typename Pattern>
+    constexpr void scan(Pattern const & pattern, size_t pos, size_t const limit, std::vector<size_t> & out) const
+    {
+        for (size_t mb = 0; pos < limit && (mb = find_next(pattern, pos, limit)) != npos; pos = mb + pattern_size_)
+            out.push_back(mb);
+    }
+
+    /*!\brief Scan parts of the range on \p threads threads and combine the results.
+     * \details
+     *
+     * Every part is scanned as if a match began at its start. If the first matches of a part overlap the last match
+     * of the previous part, the part is re-scanned from the end of that match, until a match is found that is also
+     * in the part's results; from there on, the results are the same.
+     */
+    template <typename Pattern>
+    void scan_par(Pattern const & pattern, size_t const threads)
+    {
+        size_t const                     n         = std::ranges::size(urange_);
+        size_t const                     parts     = threads * par_parts_per_thread;
+        size_t const                     part_size = (n + parts - 1) / parts;
+        std::vector<std::vector<size_t>> part_matches(parts);
+
+        auto task = [&](size_t const p)
+        { scan(pattern, std::min(n, p * part_size), std::min(n, (p + 1) * part_size), part_matches[p]); };
+        par_run(parts, threads, task);
+
+        for (size_t p = 0; p < parts; ++p)
+        {
+            std::vector<size_t> const & pm    = part_matches[p];
+            size_t const                limit = std::min(n, (p + 1) * part_size);
+            size_t const                last  = matches_.empty() ? 0 : matches_.back() + pattern_size_;
+            auto                        it    = std::ranges::lower_bound(pm, last);
+
+            if (it != pm.begin()) // overlap
+            {
+                for (size_t pos = last; true; pos = matches_.back() + pattern_size_)
+                {
+                    size_t const mb = find_next(pattern, pos, limit);
+                    it              = std::ranges::lower_bound(it, pm.end(), mb);
+                    if (mb == npos || (it != pm.end() && *it == mb))
+                        break;
+                    matches_.push_back(mb);
+                }
+            }
+
+            matches_.insert(matches_.end(), it, pm.end());
+        }
+    }
+
+    template <typename Self>
+    static constexpr auto segment_impl(Self & self, size_t const i)
+    {
+        using diff_t = std::ranges::range_difference_t<decltype(self.urange_)>;
+
+        auto const   ub = radr::begin(self.urange_);
+        size_t const b  = i == 0 ? 0 : self.matches_[i - 1] + self.pattern_size_;
+        size_t const e  = i == self.matches_.size() ? std::ranges::size(self.urange_) : self.matches_[i];
+        return subborrow(self.urange_, ub + static_cast<diff_t>(b), ub + static_cast<diff_t>(e));
+    }
+
+public:
+    split_index()
+        requires std::default_initializable<URange>
+    = default;
+
+    template <typename Pattern>
+    constexpr split_index(URange urange, Pattern const & pattern, size_t const threads) :
+      urange_(std::move(urange)), pattern_size_{std::ranges::size(pattern)}
+    {
+        size_t const n = std::ranges::size(urange_);
+        if (n == 0)
+            return;
+
+        if (!std::is_constant_evaluated() && threads > 1 && pattern_size_ > 0 &&
+            n >= threads * split_indexed_min_par_size)
+        {
+            scan_par(pattern, threads);
+        }
+        else
+        {
+            scan(pattern, 0, n, matches_);
+        }
+
+        size_ = matches_.size() + 1;
+    }
+
+    //!\brief The i-th segment.
+    constexpr auto segment(size_t const i) { return segment_impl(*this, i); }
+
+    //!\brief The i-th segment.
+    constexpr auto segment(size_t const i) const { return segment_impl(*this, i); }
+
+    constexpr auto begin() { return split_indexed_iterator<URange, false>{*this, 0}; }
+
+    constexpr auto begin() const { return split_indexed_iterator<URange, true>{*this, 0}; }
+
+    constexpr auto end() { return split_indexed_iterator<URange, false>{*this, std::ptrdiff_t(size_)}; }
+
+    constexpr auto end() const { return split_indexed_iterator<URange, true>{*this, std::ptrdiff_t(size_)}; }
+
+    constexpr size_t size() const noexcept { return size_; }
+};
+
+/*!\brief Turn the pattern argument into a borrowed range (elements are viewed as a range of size 1).
+ * \details
+ *
+ * The pattern is only used during construction of the index, so it is not copied.
+ */
+template <typename URange, typename Pattern>
+constexpr auto split_indexed_pattern(Pattern const & pattern)
+{
+    using P       = std::remove_cvref_t<std::unwrap_reference_t<Pattern>>;
+    P const & pat = pattern;
+
+    if constexpr (comparable_ranges<URange, P const>)
+    {
+        if constexpr (std::same_as<P, Pattern>)
+        {
+            static_assert(borrowed_mp_range<P>,
+                          "The Pattern must be a const-iterable, borrowed range. "
+                          "Did you forgot to wrap it in std::ref or std::cref?");
+        }
+        return radr::detail::as_const_borrow(pat);
+    }
+    else
+    {
+        static_assert(std::equality_comparable_with<std::ranges::range_reference_t<URange>, P const &>,
+                      "The Pattern must be an element or a range whose elements are comparable to the elements of the "
+                      "underlying range.");
+        return std::span<P const, 1>{std::addressof(pat), 1};
+    }
+}
+
+inline constexpr auto split_indexed_make =
+  []<typename URange, typename Pattern>(URange urange, Pattern const & pattern, size_t const threads)
+{
+    static_assert(std::ranges::random_access_range<URange> && std::ranges::sized_range<URange> &&
+                    std::ranges::random_access_range<URange const> && std::ranges::sized_range<URange const>,
+                  "radr::split_indexed requires a random-access, sized range.");
+
+    auto const   pattern_ = split_indexed_pattern<URange>(pattern);
+    size_t const threads_ = threads == 0 ? default_thread_count() : threads;
+    return owning_rad{split_index<URange>{std::move(urange), pattern_, threads_}};
+};
+
+struct split_indexed_fn
+{
+    //!\brief Create the index. [urange, pattern, threads]
+    template <std::ranges::forward_range URange, typename Pattern>
+    constexpr auto operator()(URange && urange, Pattern const & pattern, size_t const threads = 1) const
+    {
+        static_assert(mp_range<URange>, RADR_ASSERTSTRING_CONST_ITERABLE);
+
+        /* borrowed ranges are stored as borrowed ranges; but they need to be semiregular */
+        if constexpr (std::ranges::borrowed_range<std::remove_reference_t<URange>> &&
+                      !std::semiregular<std::remove_cvref_t<URange>>)
+        {
+            return split_indexed_make(radr::borrow(urange), pattern, threads);
+        }
+        else /* other ranges are stored by value (containers are moved) */
+        {
+            if constexpr (!std::ranges::borrowed_range<std::remove_reference_t<URange>> &&
+                          !is_shared_rad<std::remove_cvref_t<URange>>)
+            {
+                static_assert(!std::is_lvalue_reference_v<URange>, RADR_ASSERTSTRING_RVALUE);
+                static_assert(std::copyable<URange>, RADR_ASSERTSTRING_COPYABLE);
+            }
+            return split_indexed_make(std::remove_cvref_t<URange>(std::forward<URange>(urange)), pattern, threads);
+        }
+    }
+
+    //!\brief std::reference_wrapper -> unpacked and fwd'ed as borrowed range. [urange, pattern, threads]
+    template <std::ranges::forward_range URange, typename Pattern>
+    constexpr auto operator()(std::reference_wrapper<URange> const & urange,
+                              Pattern const &                        pattern,
+                              size_t const                           threads = 1) const
+    {
+        return split_indexed_make(radr::borrow(static_cast<URange &>(urange)), pattern, threads);
+    }
+
+    //!\brief Create the adaptor closure. [pattern]
+    template <typename Pattern>
+    constexpr auto operator()(Pattern pattern) const
+    {
+        return range_adaptor_closure_t{detail::bind_back(split_indexed_fn{}, std::move(pattern))};
+    }
+};
+
+} // namespace radr::detail
+
+namespace radr
+{
+
+inline namespace cpo
+{
+
+/*!\brief Like radr::split, but finds all matches on construction and allows random access to the segments.
+ * \param urange The underlying range.
+ * \param pattern The pattern to split by (see radr::split).
+ * \param threads The number of threads for the scan; 0 means std::thread::hardware_concurrency() (defaults to 1).
+ * \details
+ *
+ * On construction, the underlying range is scanned once and the positions of all matches are stored (one `size_t`
+ * per segment). This makes the returned range random-access and sized; dereferencing an iterator (or using
+ * `operator[]`) creates the segment via radr::subborrow, e.g. a std::string_view when splitting a std::string_view:
+ *
+ * ```cpp
+ * std::string_view log = "foo\nbar\nbax";
+ * auto lines = log | radr::split_indexed('\n');
+ * lines.size();      // 3
+ * lines[1];          // "bar"
+ *
+ * auto lines2 = radr::split_indexed(log, '\n', 8); // scan on 8 threads
+ * ```
+ *
+ * The segments and matches are the same as those of radr::split, and the same (vectorised) search is used. On large
+ * inputs, the range can be scanned on multiple threads. This is only supported when calling the adaptor directly
+ * (not in pipe notation), and it is only done if every thread has at least 64Ki elements to scan.
+ *
+ * Random-access to the segments makes it trivial to distribute work across threads, e.g. via radr::par::for_each.
+ *
+ * The index is stored in a radr::owning_rad (also for borrowed input), so copying the returned range copies the
+ * index (and the underlying range if it is owned). The index is not updated if the underlying range changes.
+ *
+ * ### Multi-pass adaptor
+ *
+ * * Requirements on \p urange : radr::mp_range, std::ranges::random_access_range, std::ranges::sized_range
+ * * Requirements on \p pattern : see radr::split
+ *
+ * The returned range is random-access, sized and common. It is never a std::ranges::borrowed_range.
+ *
+ * ### Single-pass adaptor
+ *
+ * Is ill-formed on single-pass ranges.
+ */
+inline constexpr auto split_indexed = detail::split_indexed_fn{};
+
+} // namespace cpo
+} // namespace radr
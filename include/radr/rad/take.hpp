@@ -14,6 +14,7 @@
 #include <iterator>
 
 #include "../detail/pipe.hpp"
+#include "../frame_resource.hpp"
 #include "../generator.hpp"
 #include "../rad_util/borrowing_rad.hpp"
 #include "radr/concepts.hpp"
@@ -111,7 +112,7 @@ inline constexpr auto take_coro = []<std::ranges::input_range URange>(URange &&
     static_assert(std::movable<URange>, RADR_ASSERTSTRING_MOVABLE);
 
     // we need to create inner functor so that it can take by value
-    return [](auto urange_, std::size_t const n)
+    return [](std::allocator_arg_t, frame_allocator_t, auto urange_, std::size_t const n)
              -> radr::generator<std::ranges::range_reference_t<URange>, std::ranges::range_value_t<URange>>
     {
         size_t i  = 0;
@@ -132,7 +133,7 @@ inline constexpr auto take_coro = []<std::ranges::input_range URange>(URange &&
             if (it == radr::end(urange_))
                 break;
         }
-    }(std::move(urange), n);
+    }(std::allocator_arg, frame_allocator(), std::move(urange), n);
 };
 
 } // namespace radr::detail
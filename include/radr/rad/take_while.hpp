@@ -15,9 +15,13 @@
 #include <utility>
 
 #include "../detail/pipe.hpp"
+#include "../frame_resource.hpp"
 #include "../generator.hpp"
 #include "../rad/filter.hpp"
+#include "../pred.hpp"
 #include "../rad_util/borrowing_rad.hpp"
+#include "radr/custom/subborrow.hpp"
+#include "radr/custom/tags.hpp"
 
 namespace radr::detail
 {
@@ -41,6 +45,29 @@ class take_while_sentinel
         return it;
     }
 
+    //!\brief Customisation for radr::find_common_end that searches via radr::detail::pred_find_if_not.
+    constexpr friend Iter tag_invoke(custom::find_common_end_tag, Iter b, take_while_sentinel const & e)
+    {
+        return pred_find_if_not(std::move(b), e.end_, *e.func_);
+    }
+
+    /*!\brief Customisation for radr::for_each_segment that searches the end first.
+     * \details
+     *
+     * Only for the predicates in radr::pred that can be searched with vector instructions; the elements are then
+     * passed as a single segment of underlying iterators.
+     */
+    template <borrowed_mp_range R, typename Fn>
+        requires pred_vectorisable<Func, Iter, Sen>
+    constexpr friend void tag_invoke(custom::for_each_segment_tag,
+                                     R &&                        urange,
+                                     Iter const &                b,
+                                     take_while_sentinel const & e,
+                                     Fn &                        fn)
+    {
+        fn(subborrow(urange, b, pred_find_if_not(b, e.end_, *e.func_)));
+    }
+
 public:
     constexpr take_while_sentinel() = default;
 
@@ -126,8 +153,8 @@ inline constexpr auto take_while_coro = []<std::ranges::input_range URange, type
                   "The constraints for radr::take_while's functor are not satisfied.");
 
     // we need to create inner functor so that it can take by value
-    return [](auto urange_,
-              Fn   fn_) -> radr::generator<std::ranges::range_reference_t<URange>, std::ranges::range_value_t<URange>>
+    return [](std::allocator_arg_t, frame_allocator_t, auto urange_, Fn fn_)
+             -> radr::generator<std::ranges::range_reference_t<URange>, std::ranges::range_value_t<URange>>
     {
         for (auto && elem : urange_)
         {
@@ -136,7 +163,7 @@ inline constexpr auto take_while_coro = []<std::ranges::input_range URange, type
             else
                 co_return;
         }
-    }(std::move(urange), std::move(fn));
+    }(std::allocator_arg, frame_allocator(), std::move(urange), std::move(fn));
 };
 
 } // namespace radr::detail
@@ -180,6 +207,10 @@ inline namespace cpo
  *
  * Multiple chained take_while adaptors are folded into one.
  *
+ * If the predicate is one of the function objects in radr::pred and the underlying range is contiguous and holds
+ * arithmetic values, the end is searched with vector instructions by radr::to_common and by the algorithms in
+ * radr/algorithm/ (see radr::for_each_segment).
+ *
  * ### Single-pass adaptor
  *
  * Requirements:
@@ -16,6 +16,7 @@
 #include "../concepts.hpp"
 #include "../custom/subborrow.hpp"
 #include "../detail/detail.hpp"
+#include "../frame_resource.hpp"
 #include "../generator.hpp"
 
 namespace radr::detail
@@ -30,11 +31,13 @@ inline constexpr auto to_single_pass_coro = detail::overloaded{
                   "You may pass any movable rvalue-to-range or copyable lvalues-to-borrowed_range to "
                   "radr::single_pass.");
 
-    return
-      [](auto urange_) -> radr::generator<std::ranges::range_reference_t<URange>, std::ranges::range_value_t<URange>>
+    return [](std::allocator_arg_t, frame_allocator_t, auto urange_)
+             -> radr::generator<std::ranges::range_reference_t<URange>, std::ranges::range_value_t<URange>>
     {
-        co_yield elements_of(urange_);
-    }(std::forward<URange>(urange));
+        // this is what elements_of() does, but without creating a nested coroutine
+        for (auto && elem : urange_)
+            co_yield std::forward<decltype(elem)>(elem);
+    }(std::allocator_arg, frame_allocator(), std::forward<URange>(urange));
 },
   []<std::ranges::input_range URange>(URange && urange) -> decltype(auto) // forward single-pass ranges as-is
 {
@@ -22,6 +22,7 @@
 #include "../detail/detail.hpp"
 #include "../detail/pipe.hpp"
 #include "../detail/semiregular_box.hpp"
+#include "../frame_resource.hpp"
 #include "../generator.hpp"
 #include "radr/range_access.hpp"
 
@@ -371,11 +372,12 @@ inline constexpr auto transform_coro = []<std::ranges::input_range URange, typen
     static_assert(std::movable<URange>, RADR_ASSERTSTRING_MOVABLE);
 
     // we need to create inner functor so that it can take by value
-    return [](auto urange_, Fn fn) -> radr::generator<ref_t, std::remove_cvref_t<ref_t>>
+    return [](std::allocator_arg_t, frame_allocator_t, auto urange_, Fn fn)
+             -> radr::generator<ref_t, std::remove_cvref_t<ref_t>>
     {
         for (auto && elem : urange_)
             co_yield fn(std::forward<decltype(elem)>(elem));
-    }(std::move(urange), std::move(fn));
+    }(std::allocator_arg, frame_allocator(), std::move(urange), std::move(fn));
 };
 
 } // namespace radr::detail
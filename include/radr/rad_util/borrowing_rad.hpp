@@ -81,10 +81,23 @@ private:
                                           Container &           container_old,
                                           Container &           container_new)
     {
-        auto it  = tag_invoke(custom::rebind_iterator_tag{}, rad.begin_, container_old, container_new);
-        auto sen = tag_invoke(custom::rebind_iterator_tag{}, rad.end_, container_old, container_new);
+        if constexpr (detail::batch_rebindable_iterator_to<Iter, Container> &&
+                      detail::batch_rebindable_iterator_to<Sent, Container>)
+        {
+            // rebind all iterators in a single walk over the containers
+            detail::rebind_walker<Container> walker{container_old, container_new};
+            auto it  = tag_invoke(custom::rebind_iterator_tag{}, rad.begin_, walker, walker);
+            auto sen = tag_invoke(custom::rebind_iterator_tag{}, rad.end_, walker, walker);
+
+            return borrowing_rad{it, sen, detail::size_or_not(rad)};
+        }
+        else
+        {
+            auto it  = tag_invoke(custom::rebind_iterator_tag{}, rad.begin_, container_old, container_new);
+            auto sen = tag_invoke(custom::rebind_iterator_tag{}, rad.end_, container_old, container_new);
 
-        return borrowing_rad{it, sen, detail::size_or_not(rad)};
+            return borrowing_rad{it, sen, detail::size_or_not(rad)};
+        }
     }
 
 public:
@@ -14,8 +14,10 @@
 
 #include <memory>
 #include <ranges>
+#include <utility>
 
 #include "../concepts.hpp"
+#include "../custom/stable_iterators.hpp"
 #include "../custom/tags.hpp"
 #include "../detail/detail.hpp"
 #include "../detail/indirect.hpp"
@@ -30,45 +32,94 @@ template <typename Range>
 concept owned_range_constraints =
   mp_range<Range> && std::same_as<Range, std::remove_cvref_t<Range>> && std::copyable<Range>;
 
+//!\brief Containers are stored directly if their iterators survive a move and indirectly (on the heap) otherwise.
+template <typename Range, typename Alloc>
+using owning_storage_t =
+  std::conditional_t<custom::stable_iterators_on_move<Range> && std::default_initializable<Range>,
+                     direct<Range>,
+                     indirect<Range, Alloc>>;
+
+template <typename Alloc, typename Range>
+using owning_alloc_t = typename std::allocator_traits<Alloc>::template rebind_alloc<std::remove_cvref_t<Range>>;
+
 } // namespace radr::detail
 
 namespace radr
 {
 
-template <detail::owned_range_constraints URange, borrowed_mp_range_object BorrowedRange>
-class owning_rad : public rad_interface<owning_rad<URange, BorrowedRange>>
+/*!\brief A range that owns a container and holds borrowed bounds (iterator and sentinel) into it.
+ * \tparam URange The container type.
+ * \tparam BorrowedRange The borrowed range type that represents the bounds.
+ * \tparam Alloc Allocator for the indirect storage of the container.
+ * \details
+ *
+ * Containers that are not covered by radr::custom::stable_iterators_on_move are stored in a separate heap allocation.
+ * This allocation is made via `Alloc` which can be provided by constructing with `std::allocator_arg`.
+ * The allocator is preserved when further adaptors are applied:
+ *
+ * ```cpp
+ * std::pmr::monotonic_buffer_resource res;
+ * auto r = radr::owning_rad{std::allocator_arg, std::pmr::polymorphic_allocator<>{&res}, std::list{1, 2, 3}}
+ *        | radr::take(2);
+ * ```
+ *
+ * Note that `Alloc` is only used for the container's "control data"; the container's own allocator is not modified.
+ */
+template <detail::owned_range_constraints URange,
+          borrowed_mp_range_object        BorrowedRange,
+          typename Alloc = std::allocator<URange>>
+class owning_rad : public rad_interface<owning_rad<URange, BorrowedRange, Alloc>>
 {
-    [[no_unique_address]] detail::indirect<URange> base_{};
-    [[no_unique_address]] BorrowedRange            bounds{};
+    using storage_t = detail::owning_storage_t<URange, Alloc>;
+
+    [[no_unique_address]] storage_t     base_{};
+    [[no_unique_address]] BorrowedRange bounds{};
 
     static constexpr bool const_symmetric = const_symmetric_range<BorrowedRange>;
 
-    template <detail::owned_range_constraints URange_, borrowed_mp_range_object BorrowedRange_>
+    template <detail::owned_range_constraints URange_, borrowed_mp_range_object BorrowedRange_, typename Alloc_>
     friend class owning_rad;
 
-public:
-    owning_rad()                          = default;
-    owning_rad(owning_rad &&)             = default;
-    owning_rad & operator=(owning_rad &&) = default;
-
-    owning_rad(owning_rad const & rhs) { *this = rhs; }
-
-    owning_rad & operator=(owning_rad const & rhs)
+    void rebind_bounds(owning_rad const & rhs)
     {
         static_assert(rebindable_iterator_to<iterator_t<BorrowedRange>, URange> &&
                         rebindable_iterator_to<sentinel_t<BorrowedRange>, URange>,
                       "This owning range adaptor is not copyable, because no working rebind-strategy could be deduced. "
                       "See radr/custom/rebind_iterator.hpp and the respective documentation; or open an issue.");
 
+        if (rhs.base_.get())
+            // using get() here intentionally bypasses deep-const of indirect() / direct()
+            bounds = rebind(rhs.bounds, *rhs.base_.get(), *base_.get());
+        else
+            bounds = BorrowedRange{};
+    }
+
+public:
+    owning_rad()              = default;
+    owning_rad(owning_rad &&) = default;
+
+    owning_rad & operator=(owning_rad && rhs) noexcept(storage_t::steals_on_move_assign)
+    {
+        if constexpr (!storage_t::steals_on_move_assign)
+        {
+            // the storage would move element-wise which invalidates the bounds, so we need to copy+rebind
+            if (base_.get_allocator() != rhs.base_.get_allocator())
+                return *this = std::as_const(rhs);
+        }
+
+        base_  = std::move(rhs.base_);
+        bounds = std::move(rhs.bounds);
+        return *this;
+    }
+
+    owning_rad(owning_rad const & rhs) : base_(rhs.base_) { rebind_bounds(rhs); }
+
+    owning_rad & operator=(owning_rad const & rhs)
+    {
         if (this != &rhs)
         {
             base_ = rhs.base_;
-
-            if (rhs.base_.get())
-                // using get() here intentionally bypasses deep-const of indirect()
-                bounds = rebind(rhs.bounds, *rhs.base_.get(), *base_.get());
-            else
-                bounds = BorrowedRange{};
+            rebind_bounds(rhs);
         }
         return *this;
     }
@@ -80,10 +131,22 @@ public:
     constexpr owning_rad(URange && base, Fn cacher_fn) : base_(std::move(base)), bounds{std::move(cacher_fn)(*base_)}
     {}
 
+    //!\brief Construct with an allocator for the indirect storage.
+    constexpr owning_rad(std::allocator_arg_t, Alloc const & alloc, URange && base) :
+      base_(std::allocator_arg, alloc, std::move(base)), bounds{*base_}
+    {}
+
+    //!\brief Construct with an allocator for the indirect storage.
+    template <typename Fn>
+        requires std::regular_invocable<Fn &&, URange &>
+    constexpr owning_rad(std::allocator_arg_t, Alloc const & alloc, URange && base, Fn cacher_fn) :
+      base_(std::allocator_arg, alloc, std::move(base)), bounds{std::move(cacher_fn)(*base_)}
+    {}
+
     //!\brief Collapsing constructor
     template <typename Fn, typename BorrowedRange_>
         requires std::regular_invocable<Fn &&, BorrowedRange_ &>
-    constexpr owning_rad(owning_rad<URange, BorrowedRange_> && urange, Fn cacher_fn) :
+    constexpr owning_rad(owning_rad<URange, BorrowedRange_, Alloc> && urange, Fn cacher_fn) :
       base_(std::move(urange.base_)), bounds{std::move(cacher_fn)(urange.bounds)}
     {}
 
@@ -131,14 +194,29 @@ template <class Range, class CacherFn>
 owning_rad(Range &&, CacherFn)
   -> owning_rad<std::remove_cvref_t<Range>, std::invoke_result_t<CacherFn &&, std::remove_cvref_t<Range> &>>;
 
-template <class Range, class BorrowedRange_, class CacherFn>
+template <class Alloc, class Range>
+owning_rad(std::allocator_arg_t, Alloc const &, Range &&)
+  -> owning_rad<std::remove_cvref_t<Range>,
+                decltype(borrowing_rad{std::declval<std::remove_cvref_t<Range> &>()}),
+                detail::owning_alloc_t<Alloc, Range>>;
+
+template <class Alloc, class Range, class CacherFn>
+    requires std::regular_invocable<CacherFn &&, std::remove_cvref_t<Range> &>
+owning_rad(std::allocator_arg_t, Alloc const &, Range &&, CacherFn)
+  -> owning_rad<std::remove_cvref_t<Range>,
+                std::invoke_result_t<CacherFn &&, std::remove_cvref_t<Range> &>,
+                detail::owning_alloc_t<Alloc, Range>>;
+
+template <class Range, class BorrowedRange_, class Alloc, class CacherFn>
     requires std::regular_invocable<CacherFn &&, std::remove_cvref_t<BorrowedRange_> &>
-owning_rad(owning_rad<Range, BorrowedRange_> &&, CacherFn)
-  -> owning_rad<std::remove_cvref_t<Range>, std::invoke_result_t<CacherFn &&, std::remove_cvref_t<BorrowedRange_> &>>;
+owning_rad(owning_rad<Range, BorrowedRange_, Alloc> &&, CacherFn)
+  -> owning_rad<std::remove_cvref_t<Range>,
+                std::invoke_result_t<CacherFn &&, std::remove_cvref_t<BorrowedRange_> &>,
+                Alloc>;
 
 } // namespace radr
 
 //NOTE that this is typically not the case for our owning_rads; only when combined with std::views
-template <class Range, class BorrowedRange>
-inline constexpr bool std::ranges::enable_view<radr::owning_rad<Range, BorrowedRange>> =
+template <class Range, class BorrowedRange, class Alloc>
+inline constexpr bool std::ranges::enable_view<radr::owning_rad<Range, BorrowedRange, Alloc>> =
   std::ranges::view<Range> && std::ranges::view<BorrowedRange>;
@@ -0,0 +1,151 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Copyright (c) 2023-2025 Hannes Hauswedell
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See the LICENSE file for details.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include <memory>
+#include <ranges>
+
+#include "../concepts.hpp"
+#include "../detail/detail.hpp"
+#include "borrowing_rad.hpp"
+#include "owning_rad.hpp"
+#include "rad_interface.hpp"
+
+namespace radr
+{
+
+/*!\brief A range that shares ownership of an immutable container and holds borrowed bounds into it.
+ * \tparam URange The container type.
+ * \tparam BorrowedRange The borrowed range type that represents the bounds; created on `URange const &`.
+ * \details
+ *
+ * This is similar to radr::owning_rad, except that the container is reference-counted and never modified.
+ * Copying is O(1): it increments the reference count and copies the bounds. No rebinding of iterators happens.
+ * The container is destroyed when the last radr::shared_rad referring to it is destroyed.
+ *
+ * Specialisations of this type are typically created via radr::share.
+ * Applying further adaptors to a radr::shared_rad returns a radr::shared_rad again (sharing the same container).
+ * This works on lvalues as well as rvalues.
+ */
+template <detail::owned_range_constraints URange, borrowed_mp_range_object BorrowedRange>
+class shared_rad : public rad_interface<shared_rad<URange, BorrowedRange>>
+{
+    std::shared_ptr<URange const>       base_{};
+    [[no_unique_address]] BorrowedRange bounds{};
+
+    static constexpr bool const_symmetric = const_symmetric_range<BorrowedRange>;
+
+    template <detail::owned_range_constraints URange_, borrowed_mp_range_object BorrowedRange_>
+    friend class shared_rad;
+
+public:
+    shared_rad()                               = default;
+    shared_rad(shared_rad &&)                  = default;
+    shared_rad & operator=(shared_rad &&)      = default;
+    shared_rad(shared_rad const &)             = default;
+    shared_rad & operator=(shared_rad const &) = default;
+
+    explicit shared_rad(URange && base) : base_(std::make_shared<URange const>(std::move(base))), bounds{*base_} {}
+
+    template <typename Fn>
+        requires std::regular_invocable<Fn &&, URange const &>
+    shared_rad(URange && base, Fn cacher_fn) :
+      base_(std::make_shared<URange const>(std::move(base))), bounds{std::move(cacher_fn)(*base_)}
+    {}
+
+    //!\brief Construct with an allocator for the shared state (see std::allocate_shared).
+    template <typename Alloc>
+    shared_rad(std::allocator_arg_t, Alloc const & alloc, URange && base) :
+      base_(std::allocate_shared<URange const>(alloc, std::move(base))), bounds{*base_}
+    {}
+
+    //!\brief Collapsing constructor; shares the container of \p urange.
+    template <typename Fn, typename BorrowedRange_>
+        requires std::regular_invocable<Fn &&, BorrowedRange_ &>
+    shared_rad(shared_rad<URange, BorrowedRange_> urange, Fn cacher_fn) :
+      base_(std::move(urange.base_)), bounds{std::move(cacher_fn)(urange.bounds)}
+    {}
+
+    constexpr auto begin()
+        requires(!const_symmetric)
+    {
+        return radr::begin(bounds);
+    }
+
+    constexpr auto begin() const { return radr::begin(bounds); }
+
+    constexpr auto end()
+        requires(!const_symmetric)
+    {
+        return radr::end(bounds);
+    }
+
+    constexpr auto end() const { return radr::end(bounds); }
+
+    constexpr auto size()
+        requires std::ranges::sized_range<BorrowedRange>
+    {
+        return std::ranges::size(bounds);
+    }
+
+    constexpr auto size() const
+        requires std::ranges::sized_range<BorrowedRange const>
+    {
+        return std::ranges::size(bounds);
+    }
+
+    //!\brief The number of radr::shared_rad objects sharing the container.
+    long use_count() const noexcept { return base_.use_count(); }
+
+    constexpr friend bool operator==(shared_rad const & lhs, shared_rad const & rhs)
+        requires detail::weakly_equality_comparable<BorrowedRange>
+    {
+        return lhs.bounds == rhs.bounds;
+    }
+};
+
+template <class Range>
+shared_rad(Range &&)
+  -> shared_rad<std::remove_cvref_t<Range>,
+                decltype(borrowing_rad{std::declval<std::remove_cvref_t<Range> const &>()})>;
+
+template <class Range, class CacherFn>
+    requires std::regular_invocable<CacherFn &&, std::remove_cvref_t<Range> const &>
+shared_rad(Range &&, CacherFn)
+  -> shared_rad<std::remove_cvref_t<Range>, std::invoke_result_t<CacherFn &&, std::remove_cvref_t<Range> const &>>;
+
+template <class Alloc, class Range>
+shared_rad(std::allocator_arg_t, Alloc const &, Range &&)
+  -> shared_rad<std::remove_cvref_t<Range>,
+                decltype(borrowing_rad{std::declval<std::remove_cvref_t<Range> const &>()})>;
+
+template <class Range, class BorrowedRange_, class CacherFn>
+    requires std::regular_invocable<CacherFn &&, std::remove_cvref_t<BorrowedRange_> &>
+shared_rad(shared_rad<Range, BorrowedRange_>, CacherFn)
+  -> shared_rad<std::remove_cvref_t<Range>, std::invoke_result_t<CacherFn &&, std::remove_cvref_t<BorrowedRange_> &>>;
+
+} // namespace radr
+
+namespace radr::detail
+{
+
+template <typename T>
+inline constexpr bool is_shared_rad = false;
+
+template <typename URange, typename BorrowedRange>
+inline constexpr bool is_shared_rad<shared_rad<URange, BorrowedRange>> = true;
+
+} // namespace radr::detail
+
+//NOTE copying is O(1), so this is always a view
+template <class Range, class BorrowedRange>
+inline constexpr bool std::ranges::enable_view<radr::shared_rad<Range, BorrowedRange>> = true;
@@ -0,0 +1,135 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Copyright (c) 2023-2025 Hannes Hauswedell
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See the LICENSE file for details.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include <iterator>
+#include <ranges>
+#include <utility>
+
+#include "../concepts.hpp"
+#include "../detail/detail.hpp"
+#include "../range_access.hpp"
+#include "rad_interface.hpp"
+
+namespace radr::detail
+{
+
+/*!\brief Default behaviour of a single_pass_rad policy: all operations are forwarded to the underlying iterator.
+ * \details
+ *
+ * Policies derive from this type and hide the members whose behaviour they change.
+ */
+struct sp_policy_base
+{
+    template <typename UIt>
+    using value_t = std::iter_value_t<UIt>;
+
+    //!\brief Called once, when begin() is called on the range.
+    constexpr void on_begin(auto &, auto const &) {}
+
+    //!\brief Whether the iterator is at the end.
+    constexpr bool at_end(auto const & it, auto const & e) { return it == e; }
+
+    //!\brief Advance the iterator; only called if !at_end().
+    constexpr void next(auto & it, auto const &) { ++it; }
+
+    //!\brief Dereference the iterator; only called if !at_end().
+    constexpr decltype(auto) deref(auto const & it) { return *it; }
+};
+
+} // namespace radr::detail
+
+namespace radr
+{
+
+/*!\brief A move-only input range that adapts an (owned) underlying range according to a Policy.
+ * \tparam URange The underlying range type.
+ * \tparam Policy The adaptation, see radr::detail::sp_policy_base.
+ * \details
+ *
+ * This is the return type of the radr::sp adaptors. In contrast to the coroutine-based single-pass adaptors, no
+ * frame is allocated, and the compiler can see through all operations on the iterator.
+ *
+ * Like all input ranges, begin() may only be called once. The iterators refer to the range object, so the range
+ * must not be moved after begin() was called.
+ */
+template <std::ranges::input_range URange, std::movable Policy>
+class single_pass_rad : public rad_interface<single_pass_rad<URange, Policy>>
+{
+    using UIt  = iterator_t<URange>;
+    using USen = sentinel_t<URange>;
+
+    [[no_unique_address]] URange urange{};
+    [[no_unique_address]] USen   uend{};
+    [[no_unique_address]] Policy policy{};
+
+    class iterator
+    {
+        single_pass_rad *         parent = nullptr;
+        [[no_unique_address]] UIt uit{};
+
+        friend single_pass_rad;
+
+        constexpr bool at_end() const { return parent->policy.at_end(uit, parent->uend); }
+
+    public:
+        using iterator_concept = std::input_iterator_tag;
+        using value_type       = typename Policy::template value_t<UIt>;
+        using difference_type  = std::iter_difference_t<UIt>;
+
+        iterator()                             = default;
+        iterator(iterator &&)                  = default;
+        iterator & operator=(iterator &&)      = default;
+        iterator(iterator const &)             = delete;
+        iterator & operator=(iterator const &) = delete;
+
+        constexpr iterator(single_pass_rad * parent_, UIt uit_) : parent{parent_}, uit{std::move(uit_)} {}
+
+        constexpr decltype(auto) operator*() const { return parent->policy.deref(uit); }
+
+        constexpr iterator & operator++()
+        {
+            parent->policy.next(uit, parent->uend);
+            return *this;
+        }
+
+        constexpr void operator++(int) { ++*this; }
+
+        friend constexpr bool operator==(iterator const & lhs, std::default_sentinel_t) { return lhs.at_end(); }
+    };
+
+public:
+    single_pass_rad()                                    = default;
+    single_pass_rad(single_pass_rad &&)                  = default;
+    single_pass_rad & operator=(single_pass_rad &&)      = default;
+    single_pass_rad(single_pass_rad const &)             = delete;
+    single_pass_rad & operator=(single_pass_rad const &) = delete;
+
+    constexpr single_pass_rad(URange && urange_, Policy policy_) :
+      urange{std::move(urange_)}, policy{std::move(policy_)}
+    {}
+
+    constexpr iterator begin()
+    {
+        uend = radr::end(urange);
+        iterator it{this, radr::begin(urange)};
+        policy.on_begin(it.uit, uend);
+        return it;
+    }
+
+    constexpr std::default_sentinel_t end() const noexcept { return std::default_sentinel; }
+};
+
+} // namespace radr
+
+template <class URange, class Policy>
+inline constexpr bool std::ranges::enable_view<radr::single_pass_rad<URange, Policy>> = true;
@@ -0,0 +1,97 @@
+#include <sstream>
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include <radr/test/aux_ranges.hpp>
+
+#include <radr/factory/istream.hpp>
+#include <radr/factory/parse.hpp>
+
+std::string const ints = []()
+{
+    std::string str;
+    for (uint32_t i : radr::test::generate_numeric_sequence<uint32_t>(1'000'000))
+    {
+        str += std::to_string(i);
+        str += '\n';
+    }
+    return str;
+}();
+
+std::string const doubles = []()
+{
+    std::string str;
+    for (uint32_t i : radr::test::generate_numeric_sequence<uint32_t>(1'000'000))
+    {
+        str += std::to_string(i / 1000.0);
+        str += ' ';
+    }
+    return str;
+}();
+
+template <typename Val>
+std::string const & input()
+{
+    if constexpr (std::integral<Val>)
+        return ints;
+    else
+        return doubles;
+}
+
+template <typename Val>
+void istream(benchmark::State & state)
+{
+    std::string const & str = input<Val>();
+    Val count = 0;
+    for (auto _ : state)
+    {
+        std::istringstream stream{str};
+        for (Val i : radr::istream<Val>(stream))
+            count += i;
+    }
+
+    benchmark::DoNotOptimize(count);
+}
+
+template <typename Val>
+void parse_stream(benchmark::State & state)
+{
+    std::string const & str = input<Val>();
+    Val count = 0;
+    for (auto _ : state)
+    {
+        std::istringstream stream{str};
+        for (Val i : radr::parse<Val>(stream))
+            count += i;
+    }
+
+    benchmark::DoNotOptimize(count);
+}
+
+template <typename Val>
+void parse_buffer(benchmark::State & state)
+{
+    std::string const & str = input<Val>();
+    Val count = 0;
+    for (auto _ : state)
+    {
+        for (Val i : radr::parse<Val>(std::string_view{str}))
+            count += i;
+    }
+
+    benchmark::DoNotOptimize(count);
+}
+
+// warm up
+BENCHMARK_TEMPLATE(istream, uint32_t);
+
+BENCHMARK_TEMPLATE(istream, uint32_t);
+BENCHMARK_TEMPLATE(parse_stream, uint32_t);
+BENCHMARK_TEMPLATE(parse_buffer, uint32_t);
+
+BENCHMARK_TEMPLATE(istream, double);
+BENCHMARK_TEMPLATE(parse_stream, double);
+BENCHMARK_TEMPLATE(parse_buffer, double);
+
+BENCHMARK_MAIN();
@@ -2,6 +2,8 @@
 
 #include <radr/test/aux_ranges.hpp>
 
+#include <radr/algorithm/copy.hpp>
+#include <radr/pred.hpp>
 #include <radr/rad/filter.hpp>
 
 inline constexpr auto not_div_7 = [](uint32_t i) noexcept
@@ -127,6 +129,80 @@ void radr_post_chain(benchmark::State & state)
     benchmark::DoNotOptimize(count);
 }
 
+// about one in 10'000 elements
+inline constexpr uint32_t sparse_threshold = std::numeric_limits<uint32_t>::max() - 430'000;
+
+void radr_sparse_lambda(benchmark::State & state)
+{
+    auto v = std::ref(vec) | radr::filter([](uint32_t i) { return i > sparse_threshold; });
+
+    uint32_t count = 0;
+    for (auto _ : state)
+    {
+        for (uint32_t i : v)
+            count += i;
+    }
+
+    benchmark::DoNotOptimize(count);
+}
+
+void radr_sparse_pred(benchmark::State & state)
+{
+    auto v = std::ref(vec) | radr::filter(radr::pred::greater(sparse_threshold));
+
+    uint32_t count = 0;
+    for (auto _ : state)
+    {
+        for (uint32_t i : v)
+            count += i;
+    }
+
+    benchmark::DoNotOptimize(count);
+}
+
+// about every second element
+inline constexpr uint32_t dense_threshold = std::numeric_limits<uint32_t>::max() / 2;
+
+void radr_dense_loop(benchmark::State & state)
+{
+    auto v = std::ref(vec) | radr::filter([](uint32_t i) { return i > dense_threshold; });
+
+    std::vector<uint32_t> out;
+    for (auto _ : state)
+    {
+        out.clear();
+        for (uint32_t i : v)
+            out.push_back(i);
+        benchmark::DoNotOptimize(out.data());
+    }
+}
+
+void radr_dense_copy_lambda(benchmark::State & state)
+{
+    auto v = std::ref(vec) | radr::filter([](uint32_t i) { return i > dense_threshold; });
+
+    std::vector<uint32_t> out;
+    for (auto _ : state)
+    {
+        out.clear();
+        radr::copy(v, std::back_inserter(out));
+        benchmark::DoNotOptimize(out.data());
+    }
+}
+
+void radr_dense_copy_pred(benchmark::State & state)
+{
+    auto v = std::ref(vec) | radr::filter(radr::pred::greater(dense_threshold));
+
+    std::vector<uint32_t> out;
+    for (auto _ : state)
+    {
+        out.clear();
+        radr::copy(v, std::back_inserter(out));
+        benchmark::DoNotOptimize(out.data());
+    }
+}
+
 // warm up
 BENCHMARK(radr_pre);
 
@@ -146,4 +222,13 @@ BENCHMARK(radr_chain);
 BENCHMARK(std_post_chain);
 BENCHMARK(radr_post_chain);
 
+// sparse matches, opaque predicate vs. radr::pred
+BENCHMARK(radr_sparse_lambda);
+BENCHMARK(radr_sparse_pred);
+
+// dense matches, materialised via loop vs. radr::copy
+BENCHMARK(radr_dense_loop);
+BENCHMARK(radr_dense_copy_lambda);
+BENCHMARK(radr_dense_copy_pred);
+
 BENCHMARK_MAIN();
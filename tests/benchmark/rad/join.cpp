@@ -2,6 +2,7 @@
 
 #include <radr/test/aux_ranges.hpp>
 
+#include <radr/algorithm/for_each.hpp>
 #include <radr/rad/join.hpp>
 
 void std100(benchmark::State & state)
@@ -36,6 +37,21 @@ void radr100(benchmark::State & state)
     benchmark::DoNotOptimize(count);
 }
 
+void radr100_for_each(benchmark::State & state)
+{
+    std::vector<std::vector<uint32_t>> vec_of_vec;
+    for (size_t i = 0; i < 100'000; ++i)
+        vec_of_vec.push_back(radr::test::generate_numeric_sequence<uint32_t>(100));
+
+    uint32_t count = 0;
+    for (auto _ : state)
+    {
+        radr::for_each(std::ref(vec_of_vec) | radr::join, [&count](uint32_t i) { count += i; });
+    }
+
+    benchmark::DoNotOptimize(count);
+}
+
 void std10k(benchmark::State & state)
 {
     std::vector<std::vector<uint32_t>> vec_of_vec;
@@ -67,6 +83,21 @@ void radr10k(benchmark::State & state)
 
     benchmark::DoNotOptimize(count);
 }
+
+void radr10k_for_each(benchmark::State & state)
+{
+    std::vector<std::vector<uint32_t>> vec_of_vec;
+    for (size_t i = 0; i < 1'000; ++i)
+        vec_of_vec.push_back(radr::test::generate_numeric_sequence<uint32_t>(10'000));
+
+    uint32_t count = 0;
+    for (auto _ : state)
+    {
+        radr::for_each(std::ref(vec_of_vec) | radr::join, [&count](uint32_t i) { count += i; });
+    }
+
+    benchmark::DoNotOptimize(count);
+}
 void std1m(benchmark::State & state)
 {
     std::vector<std::vector<uint32_t>> vec_of_vec;
@@ -99,14 +130,32 @@ void radr1m(benchmark::State & state)
     benchmark::DoNotOptimize(count);
 }
 
+void radr1m_for_each(benchmark::State & state)
+{
+    std::vector<std::vector<uint32_t>> vec_of_vec;
+    for (size_t i = 0; i < 10; ++i)
+        vec_of_vec.push_back(radr::test::generate_numeric_sequence<uint32_t>(1'000'000));
+
+    uint32_t count = 0;
+    for (auto _ : state)
+    {
+        radr::for_each(std::ref(vec_of_vec) | radr::join, [&count](uint32_t i) { count += i; });
+    }
+
+    benchmark::DoNotOptimize(count);
+}
+
 // warm up
 BENCHMARK(radr100);
 
 BENCHMARK(std100);
 BENCHMARK(radr100);
+BENCHMARK(radr100_for_each);
 BENCHMARK(std10k);
 BENCHMARK(radr10k);
+BENCHMARK(radr10k_for_each);
 BENCHMARK(std1m);
 BENCHMARK(radr1m);
+BENCHMARK(radr1m_for_each);
 
 BENCHMARK_MAIN();
@@ -0,0 +1,142 @@
+#include <iterator>
+#include <span>
+
+#include <benchmark/benchmark.h>
+
+#include <radr/test/aux_ranges.hpp>
+
+#include <radr/rad/batch.hpp>
+#include <radr/rad/filter.hpp>
+#include <radr/rad/sp.hpp>
+#include <radr/rad/transform.hpp>
+
+inline constexpr auto not_div_7 = [](uint32_t i)
+{
+    return i % 7 != 0;
+};
+inline constexpr auto plus1 = [](uint32_t i)
+{
+    return i + 1;
+};
+
+std::vector<uint32_t> const vec = radr::test::generate_numeric_sequence<uint32_t>(10'000'000);
+
+/* A non-coroutine input range over a vector, used as the source of all single-pass pipelines (think: socket). */
+struct input_span
+{
+    struct iterator
+    {
+        using iterator_concept = std::input_iterator_tag;
+        using value_type       = uint32_t;
+        using difference_type  = std::ptrdiff_t;
+
+        uint32_t const * ptr = nullptr;
+
+        uint32_t const & operator*() const { return *ptr; }
+        iterator &       operator++()
+        {
+            ++ptr;
+            return *this;
+        }
+        void operator++(int) { ++ptr; }
+
+        friend bool operator==(iterator const & lhs, uint32_t const * rhs) { return lhs.ptr == rhs; }
+    };
+
+    std::span<uint32_t const> s;
+
+    iterator         begin() const { return {s.data()}; }
+    uint32_t const * end() const { return s.data() + s.size(); }
+};
+
+static_assert(std::ranges::input_range<input_span> && !std::ranges::forward_range<input_span>);
+
+void std_input(benchmark::State & state)
+{
+    uint32_t count = 0;
+    for (auto _ : state)
+    {
+        auto v = input_span{vec} | std::views::transform(plus1) | std::views::filter(not_div_7) |
+                 std::views::transform(plus1) | std::views::filter(not_div_7);
+
+        for (uint32_t i : v)
+            count += i;
+    }
+
+    benchmark::DoNotOptimize(count);
+}
+
+void radr_coro(benchmark::State & state)
+{
+    uint32_t count = 0;
+    for (auto _ : state)
+    {
+        auto v = input_span{vec} | radr::transform(plus1) | radr::filter(not_div_7) | radr::transform(plus1) |
+                 radr::filter(not_div_7);
+
+        for (uint32_t i : v)
+            count += i;
+    }
+
+    benchmark::DoNotOptimize(count);
+}
+
+void radr_sp(benchmark::State & state)
+{
+    uint32_t count = 0;
+    for (auto _ : state)
+    {
+        auto v = input_span{vec} | radr::sp::transform(plus1) | radr::sp::filter(not_div_7) |
+                 radr::sp::transform(plus1) | radr::sp::filter(not_div_7);
+
+        for (uint32_t i : v)
+            count += i;
+    }
+
+    benchmark::DoNotOptimize(count);
+}
+
+void radr_batch(benchmark::State & state)
+{
+    uint32_t count = 0;
+    for (auto _ : state)
+    {
+        auto v = input_span{vec} | radr::batch(1024) | radr::batch_transform(plus1) | radr::batch_filter(not_div_7) |
+                 radr::batch_transform(plus1) | radr::batch_filter(not_div_7);
+
+        for (std::span<uint32_t> b : v)
+            for (uint32_t i : b)
+                count += i;
+    }
+
+    benchmark::DoNotOptimize(count);
+}
+
+void radr_multi_pass(benchmark::State & state)
+{
+    uint32_t count = 0;
+    for (auto _ : state)
+    {
+        auto v = std::ref(vec) | radr::transform(plus1) | radr::filter(not_div_7) | radr::transform(plus1) |
+                 radr::filter(not_div_7);
+
+        for (uint32_t i : v)
+            count += i;
+    }
+
+    benchmark::DoNotOptimize(count);
+}
+
+// warm up
+BENCHMARK(std_input);
+
+// single-pass pipelines
+BENCHMARK(std_input);
+BENCHMARK(radr_coro);
+BENCHMARK(radr_sp);
+BENCHMARK(radr_batch);
+
+// the same pipeline on a multi-pass range
+BENCHMARK(radr_multi_pass);
+
+BENCHMARK_MAIN();
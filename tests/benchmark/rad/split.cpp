@@ -0,0 +1,143 @@
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#include <benchmark/benchmark.h>
+
+#include <radr/test/aux_ranges.hpp>
+
+#include <radr/rad/split.hpp>
+#include <radr/rad/split_any.hpp>
+#include <radr/rad/split_indexed.hpp>
+
+std::string make_text(size_t const line_length, std::string_view const delim = "\n")
+{
+    std::string text;
+    size_t      i = 0;
+    for (uint8_t c : radr::test::generate_numeric_sequence<uint8_t>(10'000'000, 'a', 'z'))
+    {
+        text.push_back(static_cast<char>(c));
+        if (++i % line_length == 0)
+            text.append(delim);
+    }
+    return text;
+}
+
+void std_split(benchmark::State & state)
+{
+    std::string const text = make_text(state.range(0));
+
+    size_t count = 0;
+    for (auto _ : state)
+    {
+        for (auto && line : text | std::views::split('\n'))
+            count += std::ranges::distance(line);
+    }
+
+    benchmark::DoNotOptimize(count);
+}
+
+void radr_split(benchmark::State & state)
+{
+    std::string const text = make_text(state.range(0));
+
+    size_t count = 0;
+    for (auto _ : state)
+    {
+        for (auto && line : std::ref(text) | radr::split('\n'))
+            count += line.size();
+    }
+
+    benchmark::DoNotOptimize(count);
+}
+
+void std_split_pattern(benchmark::State & state)
+{
+    std::string const text = make_text(state.range(0), "<|sep|>");
+
+    size_t count = 0;
+    for (auto _ : state)
+    {
+        for (auto && line : text | std::views::split(std::string_view{"<|sep|>"}))
+            count += std::ranges::distance(line);
+    }
+
+    benchmark::DoNotOptimize(count);
+}
+
+void radr_split_pattern(benchmark::State & state)
+{
+    std::string const text = make_text(state.range(0), "<|sep|>");
+
+    size_t count = 0;
+    for (auto _ : state)
+    {
+        for (auto && line : std::ref(text) | radr::split(std::string_view{"<|sep|>"}))
+            count += line.size();
+    }
+
+    benchmark::DoNotOptimize(count);
+}
+
+void std_find_first_of(benchmark::State & state)
+{
+    std::string const text = make_text(state.range(0), ";");
+    std::string_view  any  = " \t,;";
+
+    size_t count = 0;
+    for (auto _ : state)
+    {
+        for (auto it = text.begin(); true; ++it)
+        {
+            auto next = std::ranges::find_first_of(it, text.end(), any.begin(), any.end());
+            count += next - it;
+            if (next == text.end())
+                break;
+            it = next;
+        }
+    }
+
+    benchmark::DoNotOptimize(count);
+}
+
+void radr_split_any(benchmark::State & state)
+{
+    std::string const text = make_text(state.range(0), ";");
+
+    size_t count = 0;
+    for (auto _ : state)
+    {
+        for (auto && line : std::ref(text) | radr::split_any(std::string_view{" \t,;"}))
+            count += line.size();
+    }
+
+    benchmark::DoNotOptimize(count);
+}
+
+void radr_split_indexed(benchmark::State & state)
+{
+    std::string const text    = make_text(state.range(0));
+    size_t const      threads = state.range(1);
+
+    size_t count = 0;
+    for (auto _ : state)
+    {
+        auto lines = radr::split_indexed(std::ref(text), '\n', threads);
+        count += lines.size();
+    }
+
+    benchmark::DoNotOptimize(count);
+}
+
+// warm up
+BENCHMARK(radr_split)->Arg(80);
+
+BENCHMARK(std_split)->Arg(8)->Arg(80)->Arg(1000);
+BENCHMARK(radr_split)->Arg(8)->Arg(80)->Arg(1000);
+BENCHMARK(std_split_pattern)->Arg(8)->Arg(80)->Arg(1000);
+BENCHMARK(radr_split_pattern)->Arg(8)->Arg(80)->Arg(1000);
+BENCHMARK(std_find_first_of)->Arg(8)->Arg(80)->Arg(1000);
+BENCHMARK(radr_split_any)->Arg(8)->Arg(80)->Arg(1000);
+BENCHMARK(radr_split_indexed)->ArgsProduct({{8, 80, 1000}, {1, 4}})->UseRealTime();
+
+BENCHMARK_MAIN();
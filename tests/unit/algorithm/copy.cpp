@@ -0,0 +1,111 @@
+#include <cstdint>
+#include <iterator>
+#include <list>
+#include <random>
+#include <ranges>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <radr/test/aux_ranges.hpp>
+#include <radr/test/gtest_helpers.hpp>
+
+#include <radr/algorithm/copy.hpp>
+#include <radr/pred.hpp>
+#include <radr/rad/filter.hpp>
+#include <radr/rad/join.hpp>
+#include <radr/rad/to_common.hpp>
+#include <radr/rad/transform.hpp>
+
+std::vector<std::vector<int>> const vec_of_vec{{1, 2, 3}, {}, {4}, {5, 6}, {}};
+
+TEST(copy, join)
+{
+    std::vector<int> out(7, 0);
+    auto             it = radr::copy(std::ref(vec_of_vec) | radr::join, out.begin());
+    EXPECT_TRUE(it == out.begin() + 6);
+    EXPECT_RANGE_EQ(out, (std::vector<int>{1, 2, 3, 4, 5, 6, 0}));
+
+    std::vector<int> out2;
+    radr::copy(std::ref(vec_of_vec) | radr::join | radr::transform([](int i) { return -i; }),
+               std::back_inserter(out2));
+    EXPECT_RANGE_EQ(out2, (std::vector<int>{-1, -2, -3, -4, -5, -6}));
+
+    std::vector<std::string> strs{"foo", "", "bar"};
+    std::string              out3;
+    radr::copy(std::ref(strs) | radr::join, std::back_inserter(out3));
+    EXPECT_EQ(out3, "foobar");
+}
+
+TEST(copy, single_pass)
+{
+    std::vector<size_t> out;
+    radr::copy(radr::test::iota_input_range(0, 4), std::back_inserter(out));
+    EXPECT_RANGE_EQ(out, (std::vector<size_t>{0, 1, 2, 3}));
+}
+
+/* compare radr::copy of filter with std::ranges::copy_if on many (unaligned) subranges */
+template <typename T, typename Pred>
+void check_copy_filter(std::vector<T> const & vec, Pred const & pred)
+{
+    for (size_t b = 0; b < 8; ++b)
+    {
+        for (size_t e = b; e <= vec.size(); e += 61)
+        {
+            std::vector<T> expected;
+            std::ranges::copy_if(vec.begin() + b, vec.begin() + e, std::back_inserter(expected), pred);
+
+            auto const     sub = radr::borrowing_rad{vec.begin() + b, vec.begin() + e};
+            std::vector<T> out;
+            radr::copy(sub | radr::filter(pred), std::back_inserter(out));
+            EXPECT_RANGE_EQ(out, expected);
+
+            std::vector<T> out2(expected.size() + 1, T{});
+            T *            it = radr::copy(sub | radr::filter(pred) | radr::to_common, out2.data());
+            EXPECT_EQ(it - out2.data(), static_cast<ptrdiff_t>(expected.size()));
+            out2.pop_back();
+            EXPECT_RANGE_EQ(out2, expected);
+        }
+    }
+}
+
+template <typename T>
+void check_copy_filter_all_preds(T const lo, T const hi)
+{
+    std::mt19937_64 gen{42};
+    std::vector<T>  vec(1000);
+    for (T & v : vec)
+    {
+        if constexpr (std::floating_point<T>)
+            v = std::uniform_real_distribution<T>{lo, hi}(gen);
+        else
+            v = static_cast<T>(std::uniform_int_distribution<int64_t>{lo, hi}(gen));
+    }
+    T const mid = vec[500];
+
+    check_copy_filter(vec, radr::pred::less(mid)); // dense
+    check_copy_filter(vec, radr::pred::greater(mid));
+    check_copy_filter(vec, radr::pred::equal_to(mid)); // sparse
+    check_copy_filter(vec, radr::pred::in_range(lo, mid));
+    check_copy_filter(vec, [mid](T v) { return v < mid; });
+    if constexpr (!std::floating_point<T>)
+        check_copy_filter(vec, radr::pred::any_of_set{lo, mid, hi});
+}
+
+TEST(copy, filter)
+{
+    check_copy_filter_all_preds<char>('a', 'z');
+    check_copy_filter_all_preds<uint8_t>(0, 255);
+    check_copy_filter_all_preds<int16_t>(-30000, 30000);
+    check_copy_filter_all_preds<int32_t>(-100, 100);
+    check_copy_filter_all_preds<uint32_t>(0, 4'000'000'000u);
+    check_copy_filter_all_preds<int64_t>(-1'000'000'000'000, 1'000'000'000'000);
+    check_copy_filter_all_preds<float>(-1.f, 1.f);
+    check_copy_filter_all_preds<double>(-1., 1.);
+
+    /* not contiguous */
+    std::list<int>   l{1, 5, 2, 6};
+    std::vector<int> out;
+    radr::copy(std::ref(l) | radr::filter(radr::pred::greater(4)), std::back_inserter(out));
+    EXPECT_RANGE_EQ(out, (std::vector<int>{5, 6}));
+}
@@ -0,0 +1,32 @@
+#include <functional>
+#include <ranges>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <radr/test/aux_ranges.hpp>
+#include <radr/test/gtest_helpers.hpp>
+
+#include <radr/algorithm/fold.hpp>
+#include <radr/rad/join.hpp>
+#include <radr/rad/take.hpp>
+
+std::vector<std::vector<int>> const vec_of_vec{{1, 2, 3}, {}, {4}, {5, 6}, {}};
+
+TEST(fold, join)
+{
+    EXPECT_EQ(radr::fold(std::ref(vec_of_vec) | radr::join, 0, std::plus<>{}), 21);
+    EXPECT_EQ(radr::fold(std::ref(vec_of_vec) | radr::join | radr::take(4), 10, std::plus<>{}), 20);
+
+    /* left-to-right and accumulator type */
+    auto concat = [](std::string s, int i) { return s + std::to_string(i); };
+    EXPECT_EQ(radr::fold(std::ref(vec_of_vec) | radr::join, std::string{">"}, concat), ">123456");
+    EXPECT_EQ(radr::fold(std::vector<int>{}, 2.5, std::plus<>{}), 2.5);
+    EXPECT_SAME_TYPE(decltype(radr::fold(vec_of_vec[0], 0, std::plus<>{})), int);
+    EXPECT_SAME_TYPE(decltype(radr::fold(vec_of_vec[0], 0.0, std::plus<>{})), double);
+}
+
+TEST(fold, single_pass)
+{
+    EXPECT_EQ(radr::fold(radr::test::iota_input_range(0, 5), size_t{0}, std::plus<>{}), 10u);
+}
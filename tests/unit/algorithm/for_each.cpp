@@ -0,0 +1,31 @@
+#include <ranges>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <radr/test/aux_ranges.hpp>
+#include <radr/test/gtest_helpers.hpp>
+
+#include <radr/algorithm/for_each.hpp>
+#include <radr/rad/join.hpp>
+
+std::vector<std::vector<int>> const vec_of_vec{{1, 2, 3}, {}, {4}, {5, 6}, {}};
+
+TEST(for_each, join)
+{
+    std::vector<int> out;
+    auto             fn = radr::for_each(std::ref(vec_of_vec) | radr::join, [&](int i) { out.push_back(i); });
+    fn(7);
+    EXPECT_RANGE_EQ(out, (std::vector<int>{1, 2, 3, 4, 5, 6, 7}));
+
+    /* writes */
+    std::vector<std::vector<int>> v = vec_of_vec;
+    radr::for_each(std::ref(v) | radr::join, [](int & i) { i *= 2; });
+    EXPECT_RANGE_EQ(std::ref(v) | radr::join, (std::vector<int>{2, 4, 6, 8, 10, 12}));
+}
+
+TEST(for_each, single_pass)
+{
+    std::vector<size_t> out;
+    radr::for_each(radr::test::iota_input_range(0, 4), [&](size_t i) { out.push_back(i); });
+    EXPECT_RANGE_EQ(out, (std::vector<size_t>{0, 1, 2, 3}));
+}
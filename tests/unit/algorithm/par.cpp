@@ -0,0 +1,100 @@
+#include <atomic>
+#include <numeric>
+#include <ranges>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <radr/test/gtest_helpers.hpp>
+
+#include <radr/algorithm/par.hpp>
+#include <radr/rad/filter.hpp>
+#include <radr/rad/join.hpp>
+#include <radr/rad/take.hpp>
+#include <radr/rad/transform.hpp>
+
+TEST(par, for_each)
+{
+    std::vector<int> in(10'000);
+    std::iota(in.begin(), in.end(), 0);
+
+    radr::par::for_each(in, [](int & i) { i *= 2; }, 4);
+
+    for (size_t i = 0; i < in.size(); ++i)
+        EXPECT_EQ(in[i], int(i) * 2);
+}
+
+TEST(par, count_if)
+{
+    std::vector<int> in(10'000);
+    std::iota(in.begin(), in.end(), 0);
+
+    auto is_odd = [](int i) { return i % 2 == 1; };
+    EXPECT_EQ(radr::par::count_if(in, is_odd, 3), 5'000);
+    EXPECT_EQ(radr::par::count_if(in, is_odd), 5'000);
+
+    auto rng = std::ref(in) | radr::filter([](int i) { return i % 3 == 0; });
+    EXPECT_EQ(radr::par::count_if(rng, is_odd, 4), std::ranges::count_if(rng, is_odd));
+}
+
+TEST(par, reduce)
+{
+    std::vector<int> in(10'000);
+    std::iota(in.begin(), in.end(), 0);
+
+    auto rng = std::ref(in) | radr::transform([](int i) { return size_t(i) * 2; }) | radr::take(1000);
+    EXPECT_EQ(radr::par::reduce(rng, size_t{0}), 999'000u);
+    EXPECT_EQ(radr::par::reduce(rng, size_t{1}, std::plus<>{}, 7), 999'001u);
+
+    std::vector<int> empty;
+    EXPECT_EQ(radr::par::reduce(empty, 42), 42);
+}
+
+TEST(par, reduce_order)
+{
+    // the operation is associative, but not commutative
+    std::vector<std::vector<std::string>> in;
+    std::string                           comp = "x";
+    for (size_t i = 0; i < 100; ++i)
+    {
+        in.push_back({});
+        for (size_t j = 0; j < i % 5; ++j)
+        {
+            in.back().push_back(std::to_string(i * 10 + j));
+            comp += in.back().back();
+        }
+    }
+
+    auto rng = std::ref(in) | radr::join;
+    EXPECT_EQ(radr::par::reduce(rng, std::string{"x"}, std::plus<>{}, 4), comp);
+}
+
+TEST(par, exception)
+{
+    std::vector<int> in(1000);
+    std::iota(in.begin(), in.end(), 0);
+
+    auto fn = [](int i)
+    {
+        if (i == 500)
+            throw std::runtime_error{"foo"};
+    };
+    EXPECT_THROW(radr::par::for_each(in, fn, 4), std::runtime_error);
+}
+
+TEST(par, nested)
+{
+    std::vector<std::vector<int>> in(16, std::vector<int>(1000, 1));
+
+    std::atomic<size_t> sum{0};
+    radr::par::for_each(
+      in,
+      [&sum](std::vector<int> const & inner) { sum += radr::par::reduce(inner, size_t{0}, std::plus<>{}, 4); },
+      4);
+    EXPECT_EQ(sum, 16'000u);
+
+    // repeated calls reuse the pool's threads
+    for (size_t i = 0; i < 100; ++i)
+        EXPECT_EQ(radr::par::reduce(in[0], size_t{0}, std::plus<>{}, 8), 1000u);
+}
@@ -0,0 +1,85 @@
+#include <forward_list>
+#include <list>
+#include <ranges>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <radr/test/gtest_helpers.hpp>
+
+#include <radr/custom/for_each_segment.hpp>
+#include <radr/rad/drop.hpp>
+#include <radr/rad/join.hpp>
+#include <radr/rad/take_while.hpp>
+
+using namespace std::string_view_literals;
+
+//!\brief Returns the segments of the range (as strings).
+template <typename Range>
+std::vector<std::string> segments(Range && range)
+{
+    std::vector<std::string> ret;
+    radr::for_each_segment(range,
+                           [&](auto && seg)
+                           {
+                               ret.emplace_back();
+                               for (char c : seg)
+                                   ret.back().push_back(c);
+                           });
+    return ret;
+}
+
+TEST(for_each_segment, default_)
+{
+    std::list<char> l{'f', 'o', 'o'};
+    EXPECT_RANGE_EQ(segments(l), (std::vector<std::string>{"foo"}));
+
+    std::string s = "foobar";
+    EXPECT_RANGE_EQ(segments(std::ref(s) | radr::drop(2)), (std::vector<std::string>{"obar"}));
+}
+
+TEST(for_each_segment, join)
+{
+    std::vector<std::string> v{"foo", "", "ba", "r", "", "bax"};
+    auto                     ra = std::ref(v) | radr::join;
+
+    EXPECT_RANGE_EQ(segments(ra), (std::vector<std::string>{"foo", "", "ba", "r", "", "bax"}));
+
+    /* segments of the inner ranges are contiguous */
+    radr::for_each_segment(ra,
+                           [](auto && seg) { EXPECT_TRUE(std::ranges::contiguous_range<decltype(seg)>); });
+
+    /* subranges start and end inside inner ranges */
+    auto sub = [&](size_t const b, size_t const e)
+    { return radr::subborrow(ra, std::ranges::next(ra.begin(), b), std::ranges::next(ra.begin(), e)); };
+    EXPECT_RANGE_EQ(segments(sub(0, 5)), (std::vector<std::string>{"foo", "", "ba", ""}));
+    EXPECT_RANGE_EQ(segments(sub(1, 2)), (std::vector<std::string>{"o"}));
+    EXPECT_RANGE_EQ(segments(sub(4, 8)), (std::vector<std::string>{"a", "r", "", "ba"}));
+    EXPECT_RANGE_EQ(segments(sub(3, 3)), (std::vector<std::string>{""}));
+    EXPECT_RANGE_EQ(segments(std::ref(ra) | radr::drop(6)), (std::vector<std::string>{"bax"}));
+    EXPECT_RANGE_EQ(segments(std::ref(ra) | radr::drop(9)), (std::vector<std::string>{}));
+
+    std::vector<std::string> empty;
+    EXPECT_RANGE_EQ(segments(std::ref(empty) | radr::join), (std::vector<std::string>{}));
+}
+
+TEST(for_each_segment, join_forward)
+{
+    // not common, i.e. the end is std::default_sentinel_t
+    std::forward_list<std::string> l{"foo", "bar", "", "b", "stop", "x"};
+    auto ra = std::ref(l) | radr::take_while([](std::string const & s) { return s != "stop"; }) | radr::join;
+    EXPECT_FALSE(std::ranges::common_range<decltype(ra)>);
+    EXPECT_RANGE_EQ(segments(ra), (std::vector<std::string>{"foo", "bar", "", "b"}));
+}
+
+TEST(for_each_segment, nested_join)
+{
+    std::vector<std::vector<std::string>> v{
+      {"foo", "ba"},
+      {},
+      {"r"}
+    };
+    auto ra = std::ref(v) | radr::join | radr::join;
+    EXPECT_RANGE_EQ(ra, "foobar"sv);
+    EXPECT_RANGE_EQ(segments(ra), (std::vector<std::string>{"foo", "ba", "r"}));
+}
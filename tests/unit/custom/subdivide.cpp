@@ -0,0 +1,125 @@
+#include <forward_list>
+#include <numeric>
+#include <ranges>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <radr/test/gtest_helpers.hpp>
+
+#include <radr/custom/subdivide.hpp>
+#include <radr/rad/drop.hpp>
+#include <radr/rad/filter.hpp>
+#include <radr/rad/join.hpp>
+#include <radr/rad/take.hpp>
+#include <radr/rad/transform.hpp>
+
+template <typename Parts>
+auto concat(Parts const & parts)
+{
+    std::vector<std::remove_cvref_t<std::ranges::range_reference_t<std::ranges::range_value_t<Parts>>>> ret;
+    for (auto const & part : parts)
+    {
+        EXPECT_FALSE(std::ranges::empty(part));
+        for (auto && elem : part)
+            ret.push_back(elem);
+    }
+    return ret;
+}
+
+TEST(subdivide, vector)
+{
+    std::vector<int> in(10);
+    std::iota(in.begin(), in.end(), 0);
+
+    auto parts = radr::subdivide(in, 3);
+    ASSERT_EQ(parts.size(), 3u);
+    EXPECT_EQ(parts[0].size(), 3u);
+    EXPECT_EQ(parts[1].size(), 3u);
+    EXPECT_EQ(parts[2].size(), 4u);
+    EXPECT_RANGE_EQ(concat(parts), in);
+
+    // subranges are pointer-based
+    EXPECT_SAME_TYPE(radr::iterator_t<decltype(parts[0])>, int *);
+}
+
+TEST(subdivide, more_parts_than_elements)
+{
+    std::vector<int> in{1, 2, 3};
+
+    auto parts = radr::subdivide(in, 8);
+    EXPECT_EQ(parts.size(), 3u);
+    EXPECT_RANGE_EQ(concat(parts), in);
+
+    std::vector<int> empty;
+    EXPECT_EQ(radr::subdivide(empty, 8).size(), 0u);
+}
+
+TEST(subdivide, forward_list)
+{
+    std::forward_list<int> in{1, 2, 3, 4, 5, 6, 7};
+
+    auto parts = radr::subdivide(in, 3);
+    ASSERT_EQ(parts.size(), 3u);
+    EXPECT_EQ(std::ranges::distance(parts[0]), 2);
+    EXPECT_EQ(std::ranges::distance(parts[2]), 3);
+    EXPECT_RANGE_EQ(concat(parts), (std::vector{1, 2, 3, 4, 5, 6, 7}));
+}
+
+TEST(subdivide, transform_take)
+{
+    std::vector<int> in(100);
+    std::iota(in.begin(), in.end(), 0);
+
+    auto rng   = std::ref(in) | radr::transform([](int i) { return i * 2; }) | radr::take(50);
+    auto parts = radr::subdivide(rng, 4);
+
+    ASSERT_EQ(parts.size(), 4u);
+    EXPECT_RANGE_EQ(concat(parts), rng);
+}
+
+TEST(subdivide, filter)
+{
+    std::vector<int> in(100);
+    std::iota(in.begin(), in.end(), 0);
+
+    auto rng   = std::ref(in) | radr::filter([](int i) { return i % 7 == 0; });
+    auto parts = radr::subdivide(rng, 10);
+
+    EXPECT_LE(parts.size(), 10u);
+    EXPECT_RANGE_EQ(concat(parts), rng);
+
+    // elements only at the beginning
+    auto rng2   = std::ref(in) | radr::filter([](int i) { return i < 3; });
+    auto parts2 = radr::subdivide(rng2, 10);
+    EXPECT_EQ(parts2.size(), 1u);
+    EXPECT_RANGE_EQ(concat(parts2), (std::vector{0, 1, 2}));
+
+    // explicit end in the middle of the range
+    std::vector<int> in3{1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+    auto             rng3 = std::ref(in3) | radr::filter([](int i) { return i % 2 == 1; });
+    auto             b    = radr::begin(rng3);
+    auto             e    = std::ranges::next(b, 2);
+    for (size_t k = 1; k < 5; ++k)
+        EXPECT_RANGE_EQ(concat(radr::subdivide(rng3, b, e, k)), (std::vector{1, 3}));
+    EXPECT_EQ(radr::subdivide(rng3, b, e, 2).size(), 2u);
+    EXPECT_TRUE(radr::subdivide(rng3, b, b, 2).empty());
+}
+
+TEST(subdivide, join)
+{
+    std::vector<std::vector<int>> in{{1, 2}, {}, {3}, {4, 5, 6}, {}, {}, {7}, {8, 9}, {}};
+
+    auto rng   = std::ref(in) | radr::join;
+    auto parts = radr::subdivide(rng, 3);
+
+    EXPECT_LE(parts.size(), 3u);
+    EXPECT_RANGE_EQ(concat(parts), (std::vector{1, 2, 3, 4, 5, 6, 7, 8, 9}));
+
+    for (size_t k = 1; k < 12; ++k)
+        EXPECT_RANGE_EQ(concat(radr::subdivide(rng, k)), (std::vector{1, 2, 3, 4, 5, 6, 7, 8, 9}));
+
+    // begin inside of an inner range
+    auto rng2 = std::ref(in) | radr::join | radr::drop(1);
+    for (size_t k = 1; k < 12; ++k)
+        EXPECT_RANGE_EQ(concat(radr::subdivide(rng2, k)), (std::vector{2, 3, 4, 5, 6, 7, 8, 9}));
+}
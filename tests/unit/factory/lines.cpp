@@ -0,0 +1,104 @@
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <radr/test/gtest_helpers.hpp>
+
+#include <radr/factory/lines.hpp>
+
+#if __has_include(<unistd.h>)
+#    include <unistd.h>
+#endif
+
+using namespace std::string_view_literals;
+
+// the string_views are only valid until the next increment, so they need to be copied
+template <typename Rng>
+std::vector<std::string> to_strings(Rng && rng)
+{
+    std::vector<std::string> ret;
+    for (std::string_view line : rng)
+        ret.emplace_back(line);
+    return ret;
+}
+
+TEST(lines, concepts)
+{
+    std::istringstream input("foo\nbar");
+    auto               rng = radr::lines(input);
+
+    EXPECT_TRUE(std::ranges::input_range<decltype(rng)>);
+    EXPECT_FALSE(std::ranges::forward_range<decltype(rng)>);
+    EXPECT_SAME_TYPE(std::ranges::range_reference_t<decltype(rng)>, std::string_view);
+}
+
+TEST(lines, basic)
+{
+    std::istringstream input("foo\nbar\n\nbax");
+    EXPECT_RANGE_EQ(to_strings(radr::lines(input)), (std::vector{"foo"sv, "bar"sv, ""sv, "bax"sv}));
+    EXPECT_TRUE(input.eof());
+}
+
+TEST(lines, trailing_newline)
+{
+    std::istringstream input("foo \r\nbar\n");
+    EXPECT_RANGE_EQ(to_strings(radr::lines(input)), (std::vector{"foo \r"sv, "bar"sv}));
+
+    std::istringstream input2("\n\n");
+    EXPECT_RANGE_EQ(to_strings(radr::lines(input2)), (std::vector{""sv, ""sv}));
+}
+
+TEST(lines, empty)
+{
+    std::istringstream input("");
+    auto               rng = radr::lines(input);
+    EXPECT_TRUE(rng.begin() == rng.end());
+    EXPECT_TRUE(input.eof());
+}
+
+TEST(lines, same_as_getline)
+{
+    // lines straddle the internal block boundaries, and one line is longer than a block
+    std::string str;
+    for (size_t i = 0; i < 20'000; ++i)
+    {
+        str += std::string(i % 17, 'a' + i % 26);
+        str += '\n';
+    }
+    str += std::string(200'000, 'x');
+    str += "\nlast";
+
+    std::vector<std::string> cmp;
+    {
+        std::istringstream input{str};
+        for (std::string line; std::getline(input, line);)
+            cmp.push_back(line);
+    }
+
+    std::istringstream input{str};
+    EXPECT_RANGE_EQ(to_strings(radr::lines(input)), cmp);
+}
+
+#if __has_include(<unistd.h>)
+TEST(lines, fd)
+{
+    int fds[2];
+    ASSERT_EQ(::pipe(fds), 0);
+
+    std::thread writer{[&]()
+                       {
+                           std::string_view data = "foo\nbar\nbax";
+                           EXPECT_EQ(::write(fds[1], data.data(), data.size()), static_cast<ssize_t>(data.size()));
+                           ::close(fds[1]);
+                       }};
+
+    std::vector<std::string> out = to_strings(radr::lines(fds[0]));
+    writer.join();
+    ::close(fds[0]);
+
+    EXPECT_RANGE_EQ(out, (std::vector<std::string>{"foo", "bar", "bax"}));
+}
+#endif
@@ -0,0 +1,90 @@
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <radr/test/gtest_helpers.hpp>
+
+#include <radr/factory/mmap_file.hpp>
+#include <radr/rad/filter.hpp>
+#include <radr/rad/split.hpp>
+
+using namespace std::string_view_literals;
+
+struct mmap_file : public ::testing::Test
+{
+    // unique name, so that concurrent runs of this test don't use the same file
+    std::filesystem::path path = std::filesystem::temp_directory_path() /
+                                 ("radr_mmap_file_test_" + std::to_string(std::random_device{}()) + ".txt");
+
+    void write(std::string_view content)
+    {
+        std::ofstream stream{path, std::ios::binary};
+        stream << content;
+    }
+
+    void TearDown() override { std::filesystem::remove(path); }
+};
+
+TEST_F(mmap_file, concepts)
+{
+    write("foo");
+    auto rng = radr::mmap_file(path);
+    using rng_t = decltype(rng);
+
+    EXPECT_TRUE(std::ranges::contiguous_range<rng_t>);
+    EXPECT_TRUE(std::ranges::sized_range<rng_t>);
+    EXPECT_TRUE(std::ranges::common_range<rng_t>);
+    EXPECT_TRUE(radr::mp_range<rng_t>);
+    EXPECT_TRUE(std::copyable<rng_t>);
+    EXPECT_SAME_TYPE(radr::iterator_t<rng_t>, char const *);
+}
+
+TEST_F(mmap_file, content)
+{
+    write("foo bar\nbax");
+    auto rng = radr::mmap_file(path, radr::mmap_advice::sequential);
+    EXPECT_EQ(std::ranges::size(rng), 11u);
+    EXPECT_RANGE_EQ(rng, "foo bar\nbax"sv);
+}
+
+TEST_F(mmap_file, empty)
+{
+    write("");
+    auto rng = radr::mmap_file(path);
+    EXPECT_TRUE(std::ranges::empty(rng));
+}
+
+TEST_F(mmap_file, copy)
+{
+    write("foo bar");
+    auto rng = radr::mmap_file(path, radr::mmap_advice::willneed);
+    auto cpy = rng;
+    EXPECT_EQ(std::ranges::data(rng), std::ranges::data(cpy)); // mapping is shared
+    rng = {};
+    EXPECT_RANGE_EQ(cpy, "foo bar"sv);
+}
+
+TEST_F(mmap_file, adaptors)
+{
+    write("foo\nbar\n\nbax\n");
+    auto lines = radr::mmap_file(path) | radr::split('\n') |
+                 radr::filter([](std::ranges::range auto && line) { return !std::ranges::empty(line); });
+
+    std::vector<std::string> out;
+    for (auto && line : lines)
+        out.emplace_back(std::ranges::begin(line), std::ranges::end(line));
+    EXPECT_RANGE_EQ(out, (std::vector<std::string>{"foo", "bar", "bax"}));
+
+    auto lines2 = lines; // multi-pass + copyable
+    EXPECT_EQ(std::ranges::distance(lines2), 3);
+}
+
+TEST(mmap_file_error, not_found)
+{
+    EXPECT_THROW(radr::mmap_file("/this/file/does/not/exist"), std::filesystem::filesystem_error);
+}
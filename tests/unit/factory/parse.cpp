@@ -0,0 +1,94 @@
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <radr/test/gtest_helpers.hpp>
+
+#include <radr/factory/istream.hpp>
+#include <radr/factory/parse.hpp>
+#include <radr/rad/take.hpp>
+
+using namespace std::string_view_literals;
+
+TEST(parse, concepts)
+{
+    std::istringstream input("1 2 3");
+    auto               rng = radr::parse<int>(input);
+
+    EXPECT_TRUE(std::ranges::input_range<decltype(rng)>);
+    EXPECT_FALSE(std::ranges::forward_range<decltype(rng)>);
+    EXPECT_SAME_TYPE(std::ranges::range_value_t<decltype(rng)>, int);
+}
+
+TEST(parse, integers)
+{
+    std::istringstream input(" 10 -20\n\t+30   40\n");
+    EXPECT_RANGE_EQ(radr::parse<int>(input), (std::vector<int>{10, -20, 30, 40}));
+    EXPECT_TRUE(input.eof());
+}
+
+TEST(parse, floats)
+{
+    std::istringstream input("1.5 -2 3e2 .25");
+    EXPECT_RANGE_EQ(radr::parse<double>(input), (std::vector<double>{1.5, -2.0, 300.0, 0.25}));
+
+    EXPECT_RANGE_EQ(radr::parse<float>("1.5 2.5"sv), (std::vector<float>{1.5f, 2.5f}));
+}
+
+TEST(parse, empty)
+{
+    std::istringstream input("  \n ");
+    auto               rng = radr::parse<int>(input);
+    EXPECT_TRUE(rng.begin() == rng.end());
+    EXPECT_TRUE(input.eof());
+
+    EXPECT_RANGE_EQ(radr::parse<long>(""sv), (std::vector<long>{}));
+}
+
+TEST(parse, stops_on_error)
+{
+    std::istringstream input("1 2 foo 3");
+    EXPECT_RANGE_EQ(radr::parse<int>(input), (std::vector<int>{1, 2}));
+    EXPECT_TRUE(input.fail());
+    EXPECT_FALSE(input.eof());
+
+    // same as istream
+    std::istringstream input2("1 2x 3");
+    EXPECT_RANGE_EQ(radr::parse<int>(input2), (std::vector<int>{1, 2}));
+    std::istringstream input3("1 2x 3");
+    EXPECT_RANGE_EQ(radr::istream<int>(input3), (std::vector<int>{1, 2}));
+
+    // out of range
+    EXPECT_RANGE_EQ(radr::parse<short>("1 70000 3"sv), (std::vector<short>{1}));
+}
+
+TEST(parse, buffer)
+{
+    std::string_view sv = "4 5 6";
+    EXPECT_RANGE_EQ(radr::parse<unsigned>(sv), (std::vector<unsigned>{4, 5, 6}));
+    EXPECT_RANGE_EQ(radr::parse<unsigned>(std::string{"7 8"}), (std::vector<unsigned>{7, 8}));
+}
+
+TEST(parse, block_boundaries)
+{
+    // numbers straddle the internal block boundaries
+    std::string       str;
+    std::vector<long> cmp;
+    for (long i = 0; i < 100'000; ++i)
+    {
+        long const n = i * 1'000'003 - 7;
+        str += std::to_string(n);
+        str += (i % 3 == 0) ? "  " : "\n";
+        cmp.push_back(n);
+    }
+
+    std::istringstream input(str);
+    EXPECT_RANGE_EQ(radr::parse<long>(input), cmp);
+
+    // a single token longer than a block
+    std::string        big(100'000, '0');
+    std::istringstream input2(" " + big + "1 2");
+    EXPECT_RANGE_EQ(radr::parse<int>(input2), (std::vector<int>{1, 2}));
+}
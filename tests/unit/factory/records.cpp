@@ -0,0 +1,119 @@
+#include <cstdint>
+#include <numeric>
+#include <span>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <radr/test/gtest_helpers.hpp>
+
+#include <radr/factory/records.hpp>
+
+struct sample
+{
+    std::uint64_t time;
+    float         value;
+    std::uint32_t id;
+
+    friend bool operator==(sample const &, sample const &) = default;
+};
+
+std::string to_bytes(std::vector<sample> const & samples)
+{
+    return std::string{reinterpret_cast<char const *>(samples.data()), samples.size() * sizeof(sample)};
+}
+
+std::vector<sample> make_samples(std::size_t const n)
+{
+    std::vector<sample> ret(n);
+    for (std::size_t i = 0; i < n; ++i)
+        ret[i] = sample{i * 10, static_cast<float>(i) / 2, static_cast<std::uint32_t>(i)};
+    return ret;
+}
+
+TEST(records, concepts)
+{
+    std::istringstream input;
+    auto               rng = radr::records<sample>(input);
+
+    EXPECT_TRUE(std::ranges::input_range<decltype(rng)>);
+    EXPECT_FALSE(std::ranges::forward_range<decltype(rng)>);
+    EXPECT_SAME_TYPE(std::ranges::range_reference_t<decltype(rng)>, sample const &);
+    EXPECT_SAME_TYPE(std::ranges::range_value_t<decltype(rng)>, sample);
+
+    auto brng = radr::record_batches<sample>(input);
+    EXPECT_TRUE(std::ranges::input_range<decltype(brng)>);
+    EXPECT_SAME_TYPE(std::ranges::range_reference_t<decltype(brng)>, std::span<sample const>);
+}
+
+TEST(records, basic)
+{
+    std::vector<sample> const samples = make_samples(5);
+    std::istringstream        input{to_bytes(samples)};
+
+    EXPECT_RANGE_EQ(radr::records<sample>(input), samples);
+    EXPECT_TRUE(input.eof());
+    EXPECT_TRUE(input.fail());
+}
+
+TEST(records, empty)
+{
+    std::istringstream input;
+    auto               rng = radr::records<sample>(input);
+
+    EXPECT_TRUE(rng.begin() == rng.end());
+    EXPECT_TRUE(input.eof());
+}
+
+TEST(records, multiple_blocks)
+{
+    // more records than fit into one block
+    std::vector<std::uint32_t> values(100'000);
+    std::iota(values.begin(), values.end(), 0u);
+    std::istringstream input{std::string{reinterpret_cast<char const *>(values.data()), values.size() * 4}};
+
+    EXPECT_RANGE_EQ(radr::records<std::uint32_t>(input), values);
+}
+
+TEST(records, partial_trailing_record)
+{
+    std::vector<sample> const samples = make_samples(3);
+    std::string               bytes   = to_bytes(samples);
+    bytes.resize(bytes.size() - 3);
+    std::istringstream input{bytes};
+
+    EXPECT_RANGE_EQ(radr::records<sample>(input), (std::vector<sample>{samples[0], samples[1]}));
+    EXPECT_TRUE(input.fail());
+}
+
+TEST(record_batches, basic)
+{
+    std::vector<sample> const samples = make_samples(10);
+    std::istringstream        input{to_bytes(samples)};
+
+    std::vector<std::size_t> sizes;
+    std::vector<sample>      result;
+    for (std::span<sample const> batch : radr::record_batches<sample>(input, 4))
+    {
+        sizes.push_back(batch.size());
+        result.insert(result.end(), batch.begin(), batch.end());
+    }
+
+    EXPECT_RANGE_EQ(sizes, (std::vector<std::size_t>{4, 4, 2}));
+    EXPECT_RANGE_EQ(result, samples);
+    EXPECT_TRUE(input.eof());
+}
+
+TEST(record_batches, exact_multiple)
+{
+    std::vector<sample> const samples = make_samples(8);
+    std::istringstream        input{to_bytes(samples)};
+
+    std::vector<std::size_t> sizes;
+    for (std::span<sample const> batch : radr::record_batches<sample>(input, 4))
+        sizes.push_back(batch.size());
+
+    // no empty batch at the end
+    EXPECT_RANGE_EQ(sizes, (std::vector<std::size_t>{4, 4}));
+}
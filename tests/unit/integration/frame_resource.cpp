@@ -0,0 +1,135 @@
+#include <memory_resource>
+#include <sstream>
+#include <string_view>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <radr/test/gtest_helpers.hpp>
+
+#include <radr/factory/counted.hpp>
+#include <radr/factory/iota.hpp>
+#include <radr/factory/istream.hpp>
+#include <radr/frame_resource.hpp>
+#include <radr/rad/as_rvalue.hpp>
+#include <radr/rad/drop.hpp>
+#include <radr/rad/drop_while.hpp>
+#include <radr/rad/filter.hpp>
+#include <radr/rad/join.hpp>
+#include <radr/rad/split.hpp>
+#include <radr/rad/take.hpp>
+#include <radr/rad/take_while.hpp>
+#include <radr/rad/to_single_pass.hpp>
+#include <radr/rad/transform.hpp>
+
+struct counting_resource : std::pmr::memory_resource
+{
+    size_t allocs   = 0;
+    size_t deallocs = 0;
+
+    void * do_allocate(size_t bytes, size_t alignment) override
+    {
+        ++allocs;
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void * p, size_t bytes, size_t alignment) override
+    {
+        ++deallocs;
+        std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+    }
+
+    bool do_is_equal(std::pmr::memory_resource const & other) const noexcept override { return this == &other; }
+};
+
+inline constexpr auto is_odd = [](int i)
+{
+    return i % 2 == 1;
+};
+
+TEST(frame_resource, default_resource)
+{
+    EXPECT_EQ(radr::get_frame_resource(), std::pmr::new_delete_resource());
+
+    counting_resource res;
+    {
+        radr::frame_resource_guard g{&res};
+        EXPECT_EQ(radr::get_frame_resource(), &res);
+
+        {
+            radr::frame_resource_guard g2{std::pmr::null_memory_resource()};
+            EXPECT_EQ(radr::get_frame_resource(), std::pmr::null_memory_resource());
+        }
+
+        EXPECT_EQ(radr::get_frame_resource(), &res);
+    }
+    EXPECT_EQ(radr::get_frame_resource(), std::pmr::new_delete_resource());
+
+    EXPECT_EQ(radr::set_frame_resource(&res), std::pmr::new_delete_resource());
+    EXPECT_EQ(radr::set_frame_resource(nullptr), &res);
+    EXPECT_EQ(radr::get_frame_resource(), std::pmr::new_delete_resource());
+}
+
+TEST(frame_resource, adaptors)
+{
+    counting_resource res;
+    {
+        std::vector<int> vec{1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+        radr::frame_resource_guard g{&res};
+
+        auto r = std::ref(vec) | radr::to_single_pass | radr::drop(1) | radr::drop_while([](int i) { return i < 3; }) |
+                 radr::filter(is_odd) | radr::transform([](int i) { return i * 10; }) |
+                 radr::take_while([](int i) { return i < 90; }) | radr::take(3) | radr::as_rvalue;
+        EXPECT_EQ(res.allocs, 8u);
+
+        EXPECT_RANGE_EQ(r, (std::vector{30, 50, 70}));
+    }
+    EXPECT_EQ(res.allocs, res.deallocs);
+}
+
+TEST(frame_resource, split_join)
+{
+    counting_resource res;
+    {
+        radr::frame_resource_guard g{&res};
+
+        auto r = std::string_view{"foo bar bax "} | radr::to_single_pass | radr::split(' ') | radr::join;
+        EXPECT_RANGE_EQ(r, std::string_view{"foobarbax"});
+        EXPECT_EQ(res.allocs, 3u); // the inner ranges of split do not allocate
+    }
+    EXPECT_EQ(res.allocs, res.deallocs);
+}
+
+TEST(frame_resource, factories)
+{
+    counting_resource res;
+    {
+        radr::frame_resource_guard g{&res};
+
+        std::istringstream stream{"1 2 3"};
+        auto               r = radr::istream<int>(stream);
+        EXPECT_RANGE_EQ(r, (std::vector{1, 2, 3}));
+        EXPECT_EQ(res.allocs, 1u);
+
+        EXPECT_RANGE_EQ(radr::iota_sp(0, 3), (std::vector{0, 1, 2}));
+        EXPECT_EQ(res.allocs, 2u);
+
+        std::vector<int> vec{1, 2, 3};
+        EXPECT_RANGE_EQ(radr::counted_sp(vec.begin(), 2), (std::vector{1, 2}));
+        EXPECT_EQ(res.allocs, 3u);
+    }
+    EXPECT_EQ(res.allocs, res.deallocs);
+}
+
+TEST(frame_resource, thread_frame_pool)
+{
+    std::vector<int> vec{1, 2, 3, 4, 5, 6};
+
+    radr::frame_resource_guard g{radr::thread_frame_pool()};
+
+    for (int i = 0; i < 3; ++i)
+    {
+        auto r = std::ref(vec) | radr::to_single_pass | radr::filter(is_odd) | radr::take(2);
+        EXPECT_RANGE_EQ(r, (std::vector{1, 3}));
+    }
+}
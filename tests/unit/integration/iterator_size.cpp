@@ -307,6 +307,18 @@ TEST(iterator_size, join_bidi)
 
     // std version same as above
 
+    {
+        auto v = std::ref(l) | radr::join;
+        EXPECT_EQ(sizeof(v), 64);
+        EXPECT_EQ(sizeof(v.begin()), 32);
+        EXPECT_EQ(sizeof(v.end()), 32);
+    }
+}
+
+TEST(iterator_size, join_bidi_non_contiguous)
+{
+    std::vector<std::list<int>> l;
+
     {
         auto v = std::ref(l) | radr::join;
         EXPECT_EQ(sizeof(v), 96);
@@ -1,6 +1,10 @@
 #include <cctype>
+#include <forward_list>
+#include <list>
+#include <map>
 #include <ranges>
 #include <string>
+#include <vector>
 
 #include <gtest/gtest.h>
 #include <radr/test/aux_ranges.hpp>
@@ -41,3 +45,109 @@ TEST(owning_copy, owning_copy)
     auto copy = r;
     EXPECT_RANGE_EQ(copy, "SA");
 }
+
+// --------------------------------------------------------------------------
+// node-based containers (batched rebind)
+// --------------------------------------------------------------------------
+
+TEST(owning_copy, node_based)
+{
+    auto is_odd = [](int i)
+    {
+        return i % 2 == 1;
+    };
+
+    {
+        auto r = std::list{1, 2, 3, 4, 5, 6, 7, 8} | radr::drop(1) | radr::filter(is_odd) | radr::take(2);
+        EXPECT_RANGE_EQ(r, (std::vector{3, 5}));
+        auto copy = r;
+        EXPECT_RANGE_EQ(copy, (std::vector{3, 5}));
+        EXPECT_NE(&*r.begin(), &*copy.begin());
+    }
+
+    {
+        auto r = std::forward_list{1, 2, 3, 4, 5, 6, 7, 8} | radr::filter(is_odd) | radr::drop(1);
+        EXPECT_RANGE_EQ(r, (std::vector{3, 5, 7}));
+        auto copy = r;
+        EXPECT_RANGE_EQ(copy, (std::vector{3, 5, 7}));
+        EXPECT_NE(&*r.begin(), &*copy.begin());
+    }
+
+    {
+        std::map<int, int> m{
+          {1, 10},
+          {2, 20},
+          {3, 30},
+          {4, 40}
+        };
+        auto r = std::move(m) | radr::drop(1) | radr::transform([](auto const & p) { return p.second; });
+        EXPECT_RANGE_EQ(r, (std::vector{20, 30, 40}));
+        auto copy = r;
+        EXPECT_RANGE_EQ(copy, (std::vector{20, 30, 40}));
+    }
+
+    {
+        auto r = std::list<std::string>{"foo", "", "bar", "bax"} | radr::join | radr::drop(2);
+        EXPECT_RANGE_EQ(r, std::string_view{"obarbax"});
+        auto copy = r;
+        EXPECT_RANGE_EQ(copy, std::string_view{"obarbax"});
+        ++copy.begin(); // NOOP, just check that copy remains valid
+        EXPECT_RANGE_EQ(copy, std::string_view{"obarbax"});
+    }
+}
+
+TEST(owning_copy, rebind_walker)
+{
+    EXPECT_TRUE((radr::detail::batch_rebindable_iterator_to<std::list<int>::iterator, std::list<int>>));
+    EXPECT_TRUE((radr::detail::batch_rebindable_iterator_to<std::default_sentinel_t, std::list<int>>));
+    EXPECT_FALSE((radr::detail::batch_rebindable_iterator_to<std::vector<int>::iterator, std::vector<int>>));
+
+    std::list<int> l1{1, 2, 3, 4, 5};
+    std::list<int> l2 = l1;
+
+    radr::detail::rebind_walker walker{l1, l2};
+    auto const                  it3  = std::ranges::next(l1.begin(), 3);
+    auto const                  cit1 = std::ranges::next(l1.cbegin(), 1);
+
+    // ascending
+    EXPECT_EQ(walker(cit1), std::ranges::next(l2.cbegin(), 1));
+    EXPECT_EQ(walker(it3), std::ranges::next(l2.begin(), 3));
+    EXPECT_EQ(walker(l1.end()), l2.end());
+    // not ascending
+    EXPECT_EQ(walker(l1.begin()), l2.begin());
+    EXPECT_EQ(walker(cit1), std::ranges::next(l2.cbegin(), 1));
+}
+
+struct indexed_list : std::list<int>
+{
+    using std::list<int>::list;
+
+    static inline size_t hook_calls = 0;
+
+    template <typename It>
+        requires radr::detail::one_of<It, iterator, const_iterator>
+    friend std::ptrdiff_t tag_invoke(radr::custom::rebind_index_tag, indexed_list const & l, It it)
+    {
+        ++hook_calls;
+        return std::ranges::distance(l.begin(), it);
+    }
+
+    template <typename It>
+        requires radr::detail::one_of<It, iterator, const_iterator>
+    friend It tag_invoke(radr::custom::rebind_index_tag, indexed_list & l, It, std::ptrdiff_t i)
+    {
+        return std::ranges::next(It(l.begin()), i);
+    }
+};
+
+TEST(owning_copy, rebind_index_hooks)
+{
+    auto r = indexed_list{1, 2, 3, 4, 5, 6} | radr::drop(2) | radr::take(3);
+    EXPECT_RANGE_EQ(r, (std::vector{3, 4, 5}));
+
+    EXPECT_EQ(indexed_list::hook_calls, 0u);
+    auto copy = r;
+    EXPECT_RANGE_EQ(copy, (std::vector{3, 4, 5}));
+    EXPECT_NE(&*r.begin(), &*copy.begin());
+    EXPECT_GT(indexed_list::hook_calls, 0u);
+}
@@ -0,0 +1,148 @@
+#include <deque>
+#include <list>
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <radr/test/gtest_helpers.hpp>
+
+#include <radr/custom/stable_iterators.hpp>
+#include <radr/rad/filter.hpp>
+#include <radr/rad/take.hpp>
+
+// --------------------------------------------------------------------------
+// storage
+// --------------------------------------------------------------------------
+
+TEST(owning_rad, stable_iterators_on_move)
+{
+    EXPECT_TRUE(radr::custom::stable_iterators_on_move<std::vector<int>>);
+#if defined(__GLIBCXX__) || defined(_LIBCPP_VERSION)
+    EXPECT_TRUE(radr::custom::stable_iterators_on_move<std::deque<int>>);
+#else
+    EXPECT_FALSE(radr::custom::stable_iterators_on_move<std::deque<int>>);
+#endif
+    EXPECT_FALSE(radr::custom::stable_iterators_on_move<std::string>);
+    EXPECT_FALSE(radr::custom::stable_iterators_on_move<std::list<int>>);
+}
+
+TEST(owning_rad, direct_storage)
+{
+    using vec_t  = decltype(std::vector{1, 2, 3} | radr::take(2));
+    using list_t = decltype(std::list{1, 2, 3} | radr::take(2));
+
+    // vector is stored in the adaptor, list is stored behind a pointer
+    EXPECT_GE(sizeof(vec_t), sizeof(std::vector<int>));
+    EXPECT_LT(sizeof(list_t), sizeof(std::list<int>) + sizeof(radr::iterator_t<list_t>));
+}
+
+template <typename Container>
+void move_and_copy_test()
+{
+    auto is_odd = [](int i)
+    {
+        return i % 2 == 1;
+    };
+
+    auto r = Container{1, 2, 3, 4, 5, 6, 7} | radr::filter(is_odd) | radr::take(3);
+    EXPECT_RANGE_EQ(r, (std::vector{1, 3, 5}));
+
+    // move construct
+    auto r2 = std::move(r);
+    EXPECT_RANGE_EQ(r2, (std::vector{1, 3, 5}));
+
+    // copy construct
+    auto r3 = r2;
+    EXPECT_RANGE_EQ(r3, (std::vector{1, 3, 5}));
+
+    // move assign
+    decltype(r2) r4;
+    r4 = std::move(r2);
+    EXPECT_RANGE_EQ(r4, (std::vector{1, 3, 5}));
+
+    // copy assign
+    decltype(r2) r5;
+    r5 = r4;
+    EXPECT_RANGE_EQ(r5, (std::vector{1, 3, 5}));
+    EXPECT_RANGE_EQ(r4, (std::vector{1, 3, 5}));
+
+    // copies are independent
+    r4 = decltype(r4){};
+    EXPECT_RANGE_EQ(r3, (std::vector{1, 3, 5}));
+    EXPECT_RANGE_EQ(r5, (std::vector{1, 3, 5}));
+    EXPECT_TRUE(std::ranges::empty(r4));
+}
+
+TEST(owning_rad, move_and_copy)
+{
+    move_and_copy_test<std::vector<int>>();
+    move_and_copy_test<std::deque<int>>();
+    move_and_copy_test<std::list<int>>();
+}
+
+// --------------------------------------------------------------------------
+// allocator
+// --------------------------------------------------------------------------
+
+struct counting_resource : std::pmr::memory_resource
+{
+    size_t allocs   = 0;
+    size_t deallocs = 0;
+
+    void * do_allocate(size_t bytes, size_t alignment) override
+    {
+        ++allocs;
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void * p, size_t bytes, size_t alignment) override
+    {
+        ++deallocs;
+        std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+    }
+
+    bool do_is_equal(std::pmr::memory_resource const & other) const noexcept override { return this == &other; }
+};
+
+TEST(owning_rad, allocator)
+{
+    counting_resource res;
+    {
+        std::pmr::polymorphic_allocator<> alloc{&res};
+
+        auto r = radr::owning_rad{std::allocator_arg, alloc, std::list{1, 2, 3, 4, 5}} | radr::take(3);
+        EXPECT_RANGE_EQ(r, (std::vector{1, 2, 3}));
+        EXPECT_EQ(res.allocs, 1u);
+
+        // allocator is preserved by further adaptors
+        auto r2 = std::move(r) | radr::take(2);
+        EXPECT_RANGE_EQ(r2, (std::vector{1, 2}));
+        EXPECT_EQ(res.allocs, 1u);
+
+        // move-assign with same resource steals the storage
+        auto r3 = radr::owning_rad{std::allocator_arg, alloc, std::list{7, 8, 9}} | radr::take(3) | radr::take(2);
+        static_assert(std::same_as<decltype(r2), decltype(r3)>);
+        EXPECT_EQ(res.allocs, 2u);
+        r3 = std::move(r2);
+        EXPECT_RANGE_EQ(r3, (std::vector{1, 2}));
+        EXPECT_EQ(res.allocs, 2u);
+        EXPECT_EQ(res.deallocs, 1u);
+
+        // copy uses the default resource (select_on_container_copy_construction)
+        auto r4 = r3;
+        EXPECT_RANGE_EQ(r4, (std::vector{1, 2}));
+        EXPECT_EQ(res.allocs, 2u);
+
+        // move-assign with different resource falls back to copy
+        r4 = std::move(r3);
+        EXPECT_RANGE_EQ(r4, (std::vector{1, 2}));
+        EXPECT_EQ(res.allocs, 2u);
+
+        // containers stored directly do not allocate control data
+        auto v = radr::owning_rad{std::allocator_arg, alloc, std::vector{1, 2, 3}} | radr::take(2);
+        EXPECT_RANGE_EQ(v, (std::vector{1, 2}));
+        EXPECT_EQ(res.allocs, 2u);
+    }
+    EXPECT_EQ(res.allocs, res.deallocs);
+}
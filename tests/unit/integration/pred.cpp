@@ -0,0 +1,235 @@
+#include <array>
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <list>
+#include <random>
+#include <ranges>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <radr/test/gtest_helpers.hpp>
+
+#include <radr/algorithm/for_each.hpp>
+#include <radr/pred.hpp>
+#include <radr/rad/drop_while.hpp>
+#include <radr/rad/filter.hpp>
+#include <radr/rad/take_while.hpp>
+#include <radr/rad/to_common.hpp>
+
+using namespace std::string_view_literals;
+
+TEST(pred, scalar)
+{
+    EXPECT_TRUE(radr::pred::equal_to('a')('a'));
+    EXPECT_FALSE(radr::pred::equal_to('a')('b'));
+    EXPECT_TRUE(radr::pred::less(3)(2));
+    EXPECT_FALSE(radr::pred::less(3)(3));
+    EXPECT_TRUE(radr::pred::greater(3)(4));
+    EXPECT_FALSE(radr::pred::greater(3)(3));
+    EXPECT_TRUE(radr::pred::in_range('a', 'z')('a'));
+    EXPECT_TRUE(radr::pred::in_range('a', 'z')('z'));
+    EXPECT_FALSE(radr::pred::in_range('a', 'z')('A'));
+
+    radr::pred::any_of_set ws{' ', '\t'};
+    EXPECT_SAME_TYPE(decltype(ws), (radr::pred::any_of_set<char, 2>));
+    EXPECT_TRUE(ws(' '));
+    EXPECT_TRUE(ws('\t'));
+    EXPECT_FALSE(ws('\n'));
+    EXPECT_EQ(ws.values(), (std::array<char, 2>{' ', '\t'}));
+    EXPECT_TRUE((radr::pred::any_of_set{3, 5}(5l)));
+
+    /* integers are compared by value */
+    EXPECT_TRUE(radr::pred::less(0)(-1l));
+    EXPECT_TRUE(radr::pred::less(0u)(-1)); // -1 < 0u is false in C++
+    EXPECT_TRUE(radr::pred::greater(-1)(0u));
+    EXPECT_FALSE(radr::pred::equal_to(-1)(std::numeric_limits<unsigned>::max()));
+    EXPECT_TRUE(radr::pred::in_range(-1, 1)(0u));
+    EXPECT_FALSE(radr::pred::any_of_set{-1}(std::numeric_limits<unsigned>::max()));
+}
+
+/* compare pred_find_if[_not] on many (unaligned) subranges with std::ranges::find_if[_not] */
+template <typename T, typename Pred>
+void check_find(std::vector<T> const & vec, Pred const & pred)
+{
+    for (size_t b = 0; b < 8; ++b)
+    {
+        for (size_t e = b; e <= vec.size(); e += 7)
+        {
+            auto const first = vec.begin() + b;
+            auto const last  = vec.begin() + e;
+            EXPECT_EQ(radr::detail::pred_find_if(first, last, pred) - first,
+                      std::ranges::find_if(first, last, pred) - first);
+            EXPECT_EQ(radr::detail::pred_find_if_not(first, last, pred) - first,
+                      std::ranges::find_if_not(first, last, pred) - first);
+        }
+    }
+}
+
+template <typename T>
+void check_find_all_preds(T const lo, T const hi)
+{
+    EXPECT_TRUE((radr::detail::pred_vectorisable<radr::pred::less<T>, T const *, T const *>));
+
+    std::mt19937_64 gen{42};
+    for (size_t const n : {0u, 1u, 17u, 200u})
+    {
+        std::vector<T> vec(n);
+        for (T & v : vec)
+        {
+            if constexpr (std::floating_point<T>)
+                v = std::uniform_real_distribution<T>{lo, hi}(gen);
+            else
+            {
+                std::uniform_int_distribution<int64_t> dist{static_cast<int64_t>(lo), static_cast<int64_t>(hi)};
+                v = static_cast<T>(dist(gen));
+            }
+        }
+
+        T const mid = vec.empty() ? lo : vec[n / 2];
+
+        check_find(vec, radr::pred::equal_to(mid));
+        check_find(vec, radr::pred::less(mid));
+        check_find(vec, radr::pred::greater(mid));
+        check_find(vec, radr::pred::less(lo));
+        check_find(vec, radr::pred::greater(lo));
+        check_find(vec, radr::pred::in_range(lo, mid));
+        check_find(vec, radr::pred::in_range(mid, hi));
+        check_find(vec, radr::pred::in_range(hi, lo)); // empty
+
+        if constexpr (!std::floating_point<T>)
+        {
+            check_find(vec, radr::pred::any_of_set{mid});
+            check_find(vec, radr::pred::any_of_set{lo, mid, hi});
+        }
+
+        /* long runs of a single value */
+        std::vector<T> same(n, mid);
+        if (n > 0)
+            same.back() = lo;
+        check_find(same, radr::pred::equal_to(mid));
+        check_find(same, radr::pred::less(mid));
+        check_find(same, radr::pred::in_range(mid, mid));
+        if constexpr (!std::floating_point<T>)
+            check_find(same, radr::pred::any_of_set{mid});
+    }
+}
+
+TEST(pred, find_integral)
+{
+    check_find_all_preds<char>('a', 'z');
+    check_find_all_preds<signed char>(-100, 100);
+    check_find_all_preds<unsigned char>(0, 255);
+    check_find_all_preds<int16_t>(-30000, 30000);
+    check_find_all_preds<uint16_t>(0, 65535);
+    check_find_all_preds<int32_t>(-100, 100);
+    check_find_all_preds<uint32_t>(0, 4'000'000'000u);
+    check_find_all_preds<int64_t>(-1'000'000'000'000, 1'000'000'000'000);
+    check_find_all_preds<uint64_t>(0, 4'000'000'000u);
+}
+
+TEST(pred, find_floating_point)
+{
+    check_find_all_preds<float>(-1.f, 1.f);
+    check_find_all_preds<double>(-1., 1.);
+
+    double const        nan = std::numeric_limits<double>::quiet_NaN();
+    std::vector<double> vec(40, nan);
+    vec[33] = 0.5;
+    check_find(vec, radr::pred::less(1.0));
+    check_find(vec, radr::pred::greater(0.0));
+    check_find(vec, radr::pred::in_range(0.0, 1.0));
+}
+
+TEST(pred, find_mixed_types)
+{
+    std::vector<uint8_t> vec(100, 200);
+    vec[70] = 3;
+
+    check_find(vec, radr::pred::equal_to(3));     // int, vectorised
+    check_find(vec, radr::pred::equal_to(-56));   // not representable
+    check_find(vec, radr::pred::less(300));       // not representable
+    check_find(vec, radr::pred::less(-1));        // not representable
+    check_find(vec, radr::pred::greater(4u));     // unsigned, vectorised
+    check_find(vec, radr::pred::in_range(-5, 5)); // not representable
+    check_find(vec, radr::pred::any_of_set{3, 4});
+
+    std::vector<int> ivec{5, -1, 7};
+    check_find(ivec, radr::pred::less(0u));
+    check_find(ivec, radr::pred::greater(4294967295u));
+}
+
+TEST(pred, constexpr_)
+{
+    constexpr auto fn = []()
+    {
+        std::array<int, 5> arr{1, 2, 3, 4, 5};
+        return radr::detail::pred_find_if(arr.begin(), arr.end(), radr::pred::greater(3)) - arr.begin();
+    };
+    static_assert(fn() == 3);
+}
+
+TEST(pred, filter)
+{
+    std::string       text(1000, 'x');
+    std::vector<char> hits{'A', 'B', 'C', 'D'};
+    text[0]   = 'A';
+    text[3]   = 'B';
+    text[500] = 'C';
+    text[999] = 'D';
+
+    auto v1 = std::ref(text) | radr::filter(radr::pred::in_range('A', 'Z'));
+    EXPECT_RANGE_EQ(v1, hits);
+    auto v2 = std::ref(text) | radr::filter(radr::pred::any_of_set{'A', 'B', 'C', 'D'});
+    EXPECT_RANGE_EQ(v2, hits);
+    auto v3 = std::ref(text) | radr::filter(radr::pred::less('x'));
+    EXPECT_RANGE_EQ(v3, hits);
+
+    std::vector<int> vec(10'000);
+    for (size_t i = 0; i < vec.size(); ++i)
+        vec[i] = static_cast<int>(i);
+    auto v4 = std::ref(vec) | radr::filter(radr::pred::greater(9'995));
+    EXPECT_RANGE_EQ(v4, (std::vector<int>{9'996, 9'997, 9'998, 9'999}));
+
+    /* not contiguous */
+    std::list<int> l{1, 5, 2, 6};
+    EXPECT_RANGE_EQ(std::ref(l) | radr::filter(radr::pred::greater(4)), (std::vector<int>{5, 6}));
+}
+
+TEST(pred, drop_while)
+{
+    auto s1 = "  \t foo bar"sv | radr::drop_while(radr::pred::any_of_set{' ', '\t'});
+    EXPECT_EQ(s1, "foo bar"sv);
+    EXPECT_SAME_TYPE(decltype(s1), std::string_view);
+
+    auto s2 = "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaab"sv | radr::drop_while(radr::pred::equal_to('a'));
+    EXPECT_EQ(s2, "b"sv);
+
+    auto s3 = "aaaa"sv | radr::drop_while(radr::pred::equal_to('a'));
+    EXPECT_TRUE(s3.empty());
+
+    std::deque<int> d{1, 2, 3, 10, 2};
+    EXPECT_RANGE_EQ(std::ref(d) | radr::drop_while(radr::pred::less(5)), (std::vector<int>{10, 2}));
+}
+
+TEST(pred, take_while)
+{
+    std::string_view const in = "0123456789012345678901234567890123456789abc";
+
+    auto s1 = in | radr::take_while(radr::pred::in_range('0', '9')) | radr::to_common;
+    EXPECT_EQ(s1, in.substr(0, 40));
+    EXPECT_SAME_TYPE(decltype(s1), std::string_view);
+
+    auto   s2    = in | radr::take_while(radr::pred::in_range('0', '9'));
+    size_t count = 0;
+    radr::for_each(s2, [&count](char) { ++count; });
+    EXPECT_EQ(count, 40u);
+
+    size_t segments = 0;
+    radr::for_each_segment(s2, [&segments](auto const & seg) { segments += std::ranges::size(seg) == 40; });
+    EXPECT_EQ(segments, 1u);
+
+    EXPECT_RANGE_EQ(s2, in.substr(0, 40));
+}
@@ -0,0 +1,169 @@
+#include <ranges>
+#include <span>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <radr/test/aux_ranges.hpp>
+#include <radr/test/gtest_helpers.hpp>
+
+#include <radr/factory/istream.hpp>
+#include <radr/rad/batch.hpp>
+#include <radr/rad/join.hpp>
+
+// --------------------------------------------------------------------------
+// batch
+// --------------------------------------------------------------------------
+
+TEST(batch, type_checks)
+{
+    auto ra = radr::test::iota_input_range(1, 8) | radr::batch(3);
+    using ra_t = decltype(ra);
+
+    EXPECT_TRUE(std::ranges::input_range<ra_t>);
+    EXPECT_FALSE(std::ranges::forward_range<ra_t>);
+    EXPECT_SAME_TYPE(std::ranges::range_value_t<ra_t>, std::span<size_t>);
+}
+
+TEST(batch, batches)
+{
+    auto ra = radr::test::iota_input_range(1, 8) | radr::batch(3);
+
+    auto it = ra.begin();
+    EXPECT_RANGE_EQ(*it, (std::vector<size_t>{1, 2, 3}));
+    ++it;
+    EXPECT_RANGE_EQ(*it, (std::vector<size_t>{4, 5, 6}));
+    ++it;
+    EXPECT_RANGE_EQ(*it, (std::vector<size_t>{7}));
+    ++it;
+    EXPECT_EQ(it, ra.end());
+}
+
+TEST(batch, exact_and_empty)
+{
+    auto ra = radr::test::iota_input_range(1, 7) | radr::batch(3);
+    size_t n = 0;
+    for (auto && b : ra)
+    {
+        EXPECT_EQ(b.size(), 3u);
+        ++n;
+    }
+    EXPECT_EQ(n, 2u);
+
+    auto ra2 = radr::test::iota_input_range(1, 1) | radr::batch(3);
+    EXPECT_EQ(ra2.begin(), ra2.end());
+}
+
+TEST(batch, does_not_overread)
+{
+    std::istringstream stream{"1 2 3 4 5"};
+    {
+        auto ra = radr::istream<int>(stream) | radr::batch(2);
+        auto it = ra.begin();
+        EXPECT_RANGE_EQ(*it, (std::vector{1, 2}));
+    }
+
+    // the third number has not been extracted
+    int i = 0;
+    stream >> i;
+    EXPECT_EQ(i, 3);
+}
+
+TEST(batch, join)
+{
+    auto ra = radr::test::iota_input_range(1, 8) | radr::batch(3) | radr::join;
+    EXPECT_RANGE_EQ(ra, (std::vector<size_t>{1, 2, 3, 4, 5, 6, 7}));
+}
+
+// --------------------------------------------------------------------------
+// batch_transform and batch_filter
+// --------------------------------------------------------------------------
+
+TEST(batch, batch_transform_inplace)
+{
+    auto ra = radr::test::iota_input_range(1, 8) | radr::batch(3) |
+              radr::batch_transform([](size_t i) { return i * 2; });
+    EXPECT_SAME_TYPE(std::ranges::range_value_t<decltype(ra)>, std::span<size_t>);
+    EXPECT_TRUE(radr::detail::batches_owned<decltype(ra)>);
+    EXPECT_RANGE_EQ(std::move(ra) | radr::join, (std::vector<size_t>{2, 4, 6, 8, 10, 12, 14}));
+}
+
+TEST(batch, batch_transform_buffer)
+{
+    auto ra = radr::test::iota_input_range(1, 5) | radr::batch(3) |
+              radr::batch_transform([](size_t i) { return std::to_string(i); });
+    EXPECT_SAME_TYPE(std::ranges::range_value_t<decltype(ra)>, std::span<std::string>);
+
+    auto it = ra.begin();
+    EXPECT_RANGE_EQ(*it, (std::vector<std::string>{"1", "2", "3"}));
+    ++it;
+    EXPECT_RANGE_EQ(*it, (std::vector<std::string>{"4"}));
+    ++it;
+    EXPECT_EQ(it, ra.end());
+}
+
+TEST(batch, batch_filter)
+{
+    auto is_odd = [](size_t i)
+    {
+        return i % 2 == 1;
+    };
+
+    auto ra = radr::test::iota_input_range(1, 12) | radr::batch(3) | radr::batch_filter(is_odd);
+
+    auto it = ra.begin();
+    EXPECT_RANGE_EQ(*it, (std::vector<size_t>{1, 3}));
+    ++it;
+    EXPECT_RANGE_EQ(*it, (std::vector<size_t>{5}));
+    ++it;
+    EXPECT_RANGE_EQ(*it, (std::vector<size_t>{7, 9}));
+    ++it;
+    EXPECT_RANGE_EQ(*it, (std::vector<size_t>{11}));
+    ++it;
+    EXPECT_EQ(it, ra.end());
+
+    // empty batches are skipped
+    auto ra2 = radr::test::iota_input_range(1, 12) | radr::batch(1) | radr::batch_filter(is_odd) | radr::join;
+    EXPECT_RANGE_EQ(ra2, (std::vector<size_t>{1, 3, 5, 7, 9, 11}));
+}
+
+TEST(batch, borrowed_batches_not_modified)
+{
+    std::vector<size_t>                 data{1, 2, 3, 4, 5};
+    std::vector<std::span<size_t>> const batches{std::span{data}.first(3), std::span{data}.last(2)};
+
+    auto ra1 = std::vector{batches} | radr::batch_transform([](size_t i) { return i * 2; }) | radr::join;
+    EXPECT_RANGE_EQ(ra1, (std::vector<size_t>{2, 4, 6, 8, 10}));
+
+    auto ra2 = std::vector{batches} | radr::batch_filter([](size_t i) { return i % 2 == 0; }) | radr::join;
+    EXPECT_RANGE_EQ(ra2, (std::vector<size_t>{2, 4}));
+
+    EXPECT_RANGE_EQ(data, (std::vector<size_t>{1, 2, 3, 4, 5}));
+
+    /* const elements can be filtered */
+    std::vector<std::span<size_t const>> const cbatches{std::span<size_t const>{data}};
+    auto ra3 = std::vector{cbatches} | radr::batch_filter([](size_t i) { return i > 3; }) | radr::join;
+    EXPECT_RANGE_EQ(ra3, (std::vector<size_t>{4, 5}));
+}
+
+TEST(batch, bool_elements)
+{
+    std::istringstream in{"1 0 1 1 0"};
+    auto               ra = radr::istream<bool>(in) | radr::batch(2);
+    EXPECT_SAME_TYPE(std::ranges::range_value_t<decltype(ra)>, std::span<bool>);
+
+    auto it = ra.begin();
+    EXPECT_RANGE_EQ(*it, (std::vector<bool>{true, false}));
+    ++it;
+    EXPECT_RANGE_EQ(*it, (std::vector<bool>{true, true}));
+    ++it;
+    EXPECT_RANGE_EQ(*it, (std::vector<bool>{false}));
+    ++it;
+    EXPECT_EQ(it, ra.end());
+
+    auto ra2 = radr::test::iota_input_range(1, 6) | radr::batch(2) |
+               radr::batch_transform([](size_t i) { return i % 2 == 0; }) |
+               radr::batch_filter([](bool b) { return b; }) | radr::join;
+    EXPECT_RANGE_EQ(ra2, (std::vector<bool>{true, true}));
+}
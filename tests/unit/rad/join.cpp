@@ -1,6 +1,11 @@
+#include <array>
+#include <deque>
 #include <forward_list>
 #include <list>
 #include <ranges>
+#include <span>
+#include <string>
+#include <vector>
 
 #include <gtest/gtest.h>
 #include <radr/test/adaptor_template.hpp>
@@ -8,6 +13,8 @@
 #include <radr/test/gtest_helpers.hpp>
 
 #include <radr/rad/join.hpp>
+#include <radr/rad/slice.hpp>
+#include <radr/rad/take.hpp>
 #include <radr/rad/to_single_pass.hpp>
 
 using namespace std::string_view_literals;
@@ -178,3 +185,173 @@ TEST(join, bidi_range_reverse)
     auto ra = std::ref(l) | radr::join | std::views::reverse;
     EXPECT_RANGE_EQ(ra, "braboof"sv);
 }
+
+TEST(join, bidi_range_reverse_deque)
+{
+    // the end of an empty std::deque cannot be decremented (in contrast to std::list)
+    std::deque<std::deque<int>> d{{}, {1, 2}, {}, {3}, {}};
+
+    auto ra = std::ref(d) | radr::join;
+    EXPECT_RANGE_EQ(ra | std::views::reverse, (std::vector{3, 2, 1}));
+}
+
+// --------------------------------------------------------------------------
+// contiguous inner ranges (compact iterator)
+// --------------------------------------------------------------------------
+
+TEST(join, contiguous_inner_concepts)
+{
+    std::vector<std::string> v{"foo", "bar", "b"};
+
+    auto ra = std::ref(v) | radr::join;
+    EXPECT_TRUE(std::ranges::bidirectional_range<decltype(ra)>);
+    EXPECT_FALSE(std::ranges::random_access_range<decltype(ra)>);
+    EXPECT_TRUE(std::ranges::common_range<decltype(ra)>);
+    EXPECT_EQ(sizeof(ra.begin()), 4 * sizeof(void *));
+    radr::test::generic_adaptor_checks<decltype(ra), decltype(v)>();
+}
+
+TEST(join, contiguous_inner_iterate)
+{
+    std::vector<std::string> v{"", "foo", "", "bar", "b", ""};
+
+    auto ra = std::ref(v) | radr::join;
+    EXPECT_RANGE_EQ(ra, "foobarb"sv);
+    EXPECT_RANGE_EQ(ra | std::views::reverse, "braboof"sv);
+
+    auto it = ra.end();
+    --it;
+    EXPECT_EQ(*it, 'b');
+    --it;
+    EXPECT_EQ(*it, 'r');
+    ++it;
+    EXPECT_EQ(*it, 'b');
+    ++it;
+    EXPECT_TRUE(it == ra.end());
+    std::ranges::advance(it, -4);
+    EXPECT_EQ(*it, 'b');
+    std::ranges::advance(it, -3);
+    EXPECT_EQ(*it, 'f');
+    EXPECT_TRUE(it == ra.begin());
+
+    /* the last inner range is not empty */
+    std::vector<std::string> v2{"ab", "", "cd"};
+    EXPECT_RANGE_EQ(std::ref(v2) | radr::join | std::views::reverse, "dcba"sv);
+    EXPECT_TRUE(std::ranges::prev(radr::end(std::ref(v2) | radr::join)) ==
+                std::ranges::next(radr::begin(std::ref(v2) | radr::join), 3));
+}
+
+TEST(join, contiguous_inner_owning)
+{
+    auto ra = std::vector<std::string>{"foo", "", "bar"} | radr::join;
+
+    auto it = std::ranges::next(ra.begin(), 4);
+    EXPECT_EQ(*it, 'a');
+
+    /* copy rebinds iterators */
+    auto ra2 = ra;
+    EXPECT_RANGE_EQ(ra2, "foobar"sv);
+    EXPECT_RANGE_EQ(ra2 | std::views::reverse, "raboof"sv);
+}
+
+// --------------------------------------------------------------------------
+// random-access (inner ranges with static size)
+// --------------------------------------------------------------------------
+
+TEST(join, static_extent_concepts)
+{
+    std::vector<std::array<int, 3>> v{
+      {1, 2, 3},
+      {4, 5, 6}
+    };
+
+    auto ra = std::ref(v) | radr::join;
+    EXPECT_TRUE(std::ranges::random_access_range<decltype(ra)>);
+    EXPECT_TRUE(std::ranges::sized_range<decltype(ra)>);
+    EXPECT_TRUE(std::ranges::common_range<decltype(ra)>);
+    EXPECT_SAME_TYPE(std::ranges::range_reference_t<decltype(ra)>, int &);
+    EXPECT_SAME_TYPE(std::ranges::range_reference_t<decltype(ra) const>, int const &);
+    EXPECT_EQ(sizeof(radr::iterator_t<decltype(ra)>), 2 * sizeof(void *));
+    radr::test::generic_adaptor_checks<decltype(ra), decltype(v)>();
+
+    // dynamic size
+    std::vector<std::vector<int>> v2;
+    auto                          ra2 = std::ref(v2) | radr::join;
+    EXPECT_FALSE(std::ranges::random_access_range<decltype(ra2)>);
+}
+
+TEST(join, static_extent_random_access)
+{
+    std::vector<std::array<int, 3>> v{
+      {1, 2, 3},
+      {4, 5, 6},
+      {7, 8, 9}
+    };
+
+    auto ra = std::ref(v) | radr::join;
+    EXPECT_EQ(ra.size(), 9u);
+    EXPECT_RANGE_EQ(ra, (std::vector{1, 2, 3, 4, 5, 6, 7, 8, 9}));
+
+    for (size_t i = 0; i < 9; ++i)
+        EXPECT_EQ(ra[i], int(i) + 1);
+
+    auto it = ra.begin();
+    it += 4;
+    EXPECT_EQ(*it, 5);
+    it -= 3;
+    EXPECT_EQ(*it, 2);
+    EXPECT_EQ(it[5], 7);
+    EXPECT_EQ(*(ra.end() - 1), 9);
+    EXPECT_EQ(ra.end() - it, 8);
+    EXPECT_TRUE(it < ra.end());
+    EXPECT_TRUE(ra.begin() < it);
+
+    --it;
+    EXPECT_EQ(it, ra.begin());
+    EXPECT_RANGE_EQ(ra | std::views::reverse, (std::vector{9, 8, 7, 6, 5, 4, 3, 2, 1}));
+
+    ra[4] = 50;
+    EXPECT_EQ(v[1][1], 50);
+}
+
+TEST(join, static_extent_take_slice)
+{
+    std::vector<std::array<int, 2>> v{
+      {1, 2},
+      {3, 4},
+      {5, 6},
+      {7, 8}
+    };
+
+    auto ra = std::ref(v) | radr::join | radr::take(5) | radr::slice(1, 4);
+    EXPECT_TRUE(std::ranges::random_access_range<decltype(ra)>);
+    EXPECT_RANGE_EQ(ra, (std::vector{2, 3, 4}));
+}
+
+TEST(join, static_extent_span)
+{
+    std::vector<int>                  data{1, 2, 3, 4, 5, 6};
+    std::vector<std::span<int, 2>>    v{std::span<int, 2>{data.data(), 2}, std::span<int, 2>{data.data() + 4, 2}};
+    std::vector<std::span<int const>> v2{std::span<int const>{data}};
+
+    auto ra = std::ref(v) | radr::join;
+    EXPECT_TRUE(std::ranges::random_access_range<decltype(ra)>);
+    EXPECT_RANGE_EQ(ra, (std::vector{1, 2, 5, 6}));
+
+    EXPECT_FALSE(std::ranges::random_access_range<decltype(std::ref(v2) | radr::join)>);
+}
+
+TEST(join, static_extent_owning)
+{
+    std::vector<std::array<int, 2>> v{
+      {1, 2},
+      {3, 4}
+    };
+
+    auto ra  = std::move(v) | radr::join;
+    auto ra2 = ra;
+
+    EXPECT_RANGE_EQ(ra, (std::vector{1, 2, 3, 4}));
+    EXPECT_RANGE_EQ(ra2, (std::vector{1, 2, 3, 4}));
+    EXPECT_EQ(ra2.size(), 4u);
+}
@@ -0,0 +1,133 @@
+#include <algorithm>
+#include <array>
+#include <numeric>
+#include <ranges>
+#include <span>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <radr/test/gtest_helpers.hpp>
+
+#include <radr/rad/join_indexed.hpp>
+#include <radr/rad/reverse.hpp>
+#include <radr/rad/share.hpp>
+#include <radr/rad/slice.hpp>
+#include <radr/rad/take.hpp>
+
+using namespace std::string_view_literals;
+
+std::vector<std::string> const ragged{"foo", "" /*empty*/, "ba", "", "", "r", "bax"};
+
+TEST(join_indexed, concepts)
+{
+    std::vector<std::string> v = ragged;
+    auto                     ra = std::ref(v) | radr::join_indexed;
+    using ra_t                  = decltype(ra);
+
+    EXPECT_TRUE(std::ranges::random_access_range<ra_t>);
+    EXPECT_TRUE(std::ranges::random_access_range<ra_t const>);
+    EXPECT_FALSE(std::ranges::contiguous_range<ra_t>);
+    EXPECT_TRUE(std::ranges::sized_range<ra_t>);
+    EXPECT_TRUE(std::ranges::common_range<ra_t>);
+    EXPECT_FALSE(std::ranges::borrowed_range<ra_t>);
+    EXPECT_TRUE((std::ranges::output_range<ra_t, char>));
+    EXPECT_SAME_TYPE(std::ranges::range_reference_t<ra_t>, char &);
+    EXPECT_SAME_TYPE(std::ranges::range_reference_t<ra_t const>, char const &);
+    EXPECT_SAME_TYPE(std::ranges::range_value_t<ra_t>, char);
+
+    auto ra2 = std::vector<std::string>{ragged} | radr::join_indexed;
+    EXPECT_SAME_TYPE(std::ranges::range_reference_t<decltype(ra2)>, char &);
+    EXPECT_SAME_TYPE(std::ranges::range_reference_t<decltype(ra2) const>, char const &);
+}
+
+TEST(join_indexed, elements)
+{
+    std::vector<std::string> v  = ragged;
+    auto                     ra = std::ref(v) | radr::join_indexed;
+
+    EXPECT_EQ(ra.size(), 9u);
+    EXPECT_RANGE_EQ(ra, "foobarbax"sv);
+    EXPECT_RANGE_EQ(std::ref(ra) | radr::reverse, "xabraboof"sv);
+
+    std::string_view comp = "foobarbax";
+    for (size_t i = 0; i < comp.size(); ++i)
+        EXPECT_EQ(ra[i], comp[i]);
+
+    /* random jumps in both directions */
+    auto it = ra.begin();
+    it += 5;
+    EXPECT_EQ(*it, 'r');
+    it -= 4;
+    EXPECT_EQ(*it, 'o');
+    EXPECT_EQ(it[2], 'b');
+    EXPECT_EQ(ra.end() - it, 8);
+    it = it + 7;
+    EXPECT_EQ(*it, 'x');
+    EXPECT_TRUE(++it == ra.end());
+    EXPECT_EQ(*--it, 'x');
+
+    /* writing */
+    ra[3] = 'B';
+    EXPECT_EQ(v[2], "Ba");
+}
+
+TEST(join_indexed, empty)
+{
+    std::vector<std::vector<int>> v0;
+    auto                          ra0 = std::ref(v0) | radr::join_indexed;
+    EXPECT_TRUE(ra0.empty());
+    EXPECT_TRUE(ra0.begin() == ra0.end());
+
+    std::vector<std::vector<int>> v1{{}, {}, {}};
+    auto                          ra1 = std::ref(v1) | radr::join_indexed;
+    EXPECT_EQ(ra1.size(), 0u);
+    EXPECT_TRUE(ra1.begin() == ra1.end());
+}
+
+TEST(join_indexed, subborrow)
+{
+    std::vector<std::string> v  = ragged;
+    auto                     ra = std::ref(v) | radr::join_indexed;
+
+    auto sl = std::ref(ra) | radr::slice(2, 7);
+    EXPECT_TRUE(std::ranges::borrowed_range<decltype(sl)>);
+    EXPECT_RANGE_EQ(sl, "obarb"sv);
+    EXPECT_EQ(sl.size(), 5u);
+
+    EXPECT_RANGE_EQ(std::ref(ra) | radr::take(4), "foob"sv);
+}
+
+TEST(join_indexed, owning)
+{
+    auto ra = std::vector<std::string>{ragged} | radr::join_indexed;
+    EXPECT_RANGE_EQ(ra, "foobarbax"sv);
+
+    /* copies have their own index and underlying range */
+    auto ra2 = ra;
+    ra2[0]   = 'F';
+    EXPECT_RANGE_EQ(ra, "foobarbax"sv);
+    EXPECT_RANGE_EQ(ra2, "Foobarbax"sv);
+
+    auto ra3 = std::move(ra2);
+    EXPECT_RANGE_EQ(ra3, "Foobarbax"sv);
+
+    auto sh = std::vector<std::string>{ragged} | radr::share | radr::join_indexed;
+    EXPECT_RANGE_EQ(sh, "foobarbax"sv);
+}
+
+TEST(join_indexed, spans)
+{
+    std::vector<int>            data(100);
+    std::iota(data.begin(), data.end(), 0);
+    std::vector<std::span<int>> spans;
+    for (size_t b = 0, len = 1; b < data.size(); b += len, ++len)
+        spans.emplace_back(data.data() + b, std::min(len, data.size() - b));
+
+    auto ra = std::ref(spans) | radr::join_indexed;
+    EXPECT_RANGE_EQ(ra, data);
+    for (size_t i : {0u, 1u, 2u, 17u, 54u, 99u})
+        EXPECT_EQ(ra[i], int(i));
+    EXPECT_TRUE(std::ranges::is_sorted(ra));
+    EXPECT_TRUE(std::ranges::binary_search(ra, 42));
+}
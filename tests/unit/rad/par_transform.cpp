@@ -0,0 +1,102 @@
+#include <atomic>
+#include <chrono>
+#include <numeric>
+#include <ranges>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <radr/test/aux_ranges.hpp>
+#include <radr/test/gtest_helpers.hpp>
+
+#include <radr/rad/par_transform.hpp>
+
+TEST(par_transform, type_checks)
+{
+    auto ra = radr::test::iota_input_range(1, 8) | radr::par_transform([](size_t i) { return std::to_string(i); });
+    using ra_t = decltype(ra);
+
+    EXPECT_TRUE(std::ranges::input_range<ra_t>);
+    EXPECT_FALSE(std::ranges::forward_range<ra_t>);
+    EXPECT_SAME_TYPE(std::ranges::range_value_t<ra_t>, std::string);
+    EXPECT_SAME_TYPE(std::ranges::range_reference_t<ra_t>, std::string &);
+}
+
+TEST(par_transform, order_is_preserved)
+{
+    // later elements finish earlier
+    auto fn = [](size_t i)
+    {
+        std::this_thread::sleep_for(std::chrono::microseconds((100 - i % 100) * 10));
+        return i * 2;
+    };
+
+    std::vector<size_t> comp(500);
+    for (size_t i = 0; i < comp.size(); ++i)
+        comp[i] = (i + 1) * 2;
+
+    for (auto [threads, window] : {std::pair<size_t, size_t>{1, 1}, {4, 4}, {4, 64}, {0, 0}})
+        EXPECT_RANGE_EQ(radr::test::iota_input_range(1, 501) | radr::par_transform(fn, threads, window), comp);
+}
+
+TEST(par_transform, empty)
+{
+    auto ra = radr::test::iota_input_range(1, 1) | radr::par_transform([](size_t i) { return i; }, 2);
+    EXPECT_TRUE(ra.begin() == ra.end());
+}
+
+TEST(par_transform, runs_in_parallel)
+{
+    std::atomic<size_t> running{0};
+    std::atomic<size_t> max_running{0};
+    auto                fn = [&](size_t i)
+    {
+        size_t const r = ++running;
+        size_t       m = max_running.load();
+        while (r > m && !max_running.compare_exchange_weak(m, r))
+            ;
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        --running;
+        return i;
+    };
+
+    size_t sum = 0;
+    for (size_t i : radr::test::iota_input_range(0, 40) | radr::par_transform(fn, 4, 8))
+        sum += i;
+
+    EXPECT_EQ(sum, 780u);
+    EXPECT_GT(max_running.load(), 1u);
+    EXPECT_LE(max_running.load(), 4u);
+}
+
+TEST(par_transform, stop_early)
+{
+    auto ra = radr::test::iota_input_range(0, size_t(-1)) | radr::par_transform([](size_t i) { return i; }, 3, 6);
+
+    size_t i = 0;
+    for (size_t v : ra)
+    {
+        EXPECT_EQ(v, i);
+        if (++i == 100)
+            break;
+    }
+}
+
+TEST(par_transform, exception)
+{
+    auto fn = [](size_t i)
+    {
+        if (i == 3)
+            throw std::runtime_error{"foo"};
+        return i;
+    };
+
+    auto ra = radr::test::iota_input_range(1, 10) | radr::par_transform(fn, 2, 4);
+    auto it = ra.begin();
+    EXPECT_EQ(*it, 1u);
+    ++it;
+    EXPECT_EQ(*it, 2u);
+    EXPECT_THROW(++it, std::runtime_error);
+}
@@ -0,0 +1,111 @@
+#include <numeric>
+#include <ranges>
+#include <span>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <radr/test/aux_ranges.hpp>
+#include <radr/test/gtest_helpers.hpp>
+
+#include <radr/factory/lines.hpp>
+#include <radr/rad/batch.hpp>
+#include <radr/rad/join.hpp>
+#include <radr/rad/prefetch_async.hpp>
+
+TEST(prefetch_async, type_checks)
+{
+    auto ra = radr::test::iota_input_range(1, 8) | radr::prefetch_async(4);
+    using ra_t = decltype(ra);
+
+    EXPECT_TRUE(std::ranges::input_range<ra_t>);
+    EXPECT_FALSE(std::ranges::forward_range<ra_t>);
+    EXPECT_SAME_TYPE(std::ranges::range_value_t<ra_t>, size_t);
+    EXPECT_SAME_TYPE(std::ranges::range_reference_t<ra_t>, size_t &);
+
+    std::istringstream stream;
+    auto               lines = radr::lines(stream) | radr::prefetch_async(4);
+    EXPECT_SAME_TYPE(std::ranges::range_reference_t<decltype(lines)>, std::string_view);
+}
+
+TEST(prefetch_async, elements)
+{
+    std::vector<size_t> comp(10'000);
+    std::iota(comp.begin(), comp.end(), 1);
+
+    for (size_t n : {1u, 3u, 64u, 100'000u})
+        EXPECT_RANGE_EQ(radr::test::iota_input_range(1, 10'001) | radr::prefetch_async(n), comp);
+}
+
+TEST(prefetch_async, empty)
+{
+    auto ra = radr::test::iota_input_range(1, 1) | radr::prefetch_async(4);
+    EXPECT_TRUE(ra.begin() == ra.end());
+}
+
+TEST(prefetch_async, owning_input)
+{
+    std::vector<std::string> in{"foo", "bar", "bax"};
+    auto                     ra = std::vector<std::string>{in} | radr::prefetch_async(2);
+    EXPECT_RANGE_EQ(ra, in);
+}
+
+TEST(prefetch_async, batches)
+{
+    auto ra = radr::test::iota_input_range(1, 1001) | radr::batch(7) | radr::prefetch_async(3) | radr::join;
+
+    std::vector<size_t> comp(1000);
+    std::iota(comp.begin(), comp.end(), 1);
+    EXPECT_RANGE_EQ(ra, comp);
+}
+
+TEST(prefetch_async, lines)
+{
+    std::string input;
+    for (size_t i = 0; i < 20'000; ++i)
+        input += std::to_string(i) + "\n";
+    std::istringstream stream{input};
+
+    // the string_views of radr::lines point into a buffer that is reused; they are deep-copied
+    size_t i = 0;
+    for (std::string_view line : radr::lines(stream) | radr::prefetch_async(16))
+    {
+        EXPECT_EQ(line, std::to_string(i));
+        ++i;
+    }
+    EXPECT_EQ(i, 20'000u);
+}
+
+TEST(prefetch_async, stop_early)
+{
+    // the producer is blocked on the full ring when the range is destroyed
+    auto ra = radr::test::iota_input_range(0, size_t(-1)) | radr::prefetch_async(2);
+
+    size_t i = 0;
+    for (size_t v : ra)
+    {
+        EXPECT_EQ(v, i);
+        if (++i == 5)
+            break;
+    }
+}
+
+radr::generator<int> throwing_range()
+{
+    co_yield 1;
+    co_yield 2;
+    throw std::runtime_error{"foo"};
+}
+
+TEST(prefetch_async, exception)
+{
+    auto ra = throwing_range() | radr::prefetch_async(4);
+    auto it = ra.begin();
+    EXPECT_EQ(*it, 1);
+    ++it;
+    EXPECT_EQ(*it, 2);
+    EXPECT_THROW(++it, std::runtime_error);
+}
@@ -0,0 +1,134 @@
+#include <deque>
+#include <forward_list>
+#include <list>
+#include <memory_resource>
+#include <ranges>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <radr/test/gtest_helpers.hpp>
+
+#include <radr/concepts.hpp>
+#include <radr/rad/filter.hpp>
+#include <radr/rad/share.hpp>
+#include <radr/rad/take.hpp>
+#include <radr/rad/transform.hpp>
+
+// --------------------------------------------------------------------------
+// test data
+// --------------------------------------------------------------------------
+
+inline std::vector<int> const comp{1, 2, 3, 4, 5, 6};
+
+inline constexpr auto is_odd = [](int i)
+{
+    return i % 2 == 1;
+};
+
+// --------------------------------------------------------------------------
+// forward tests
+// --------------------------------------------------------------------------
+
+template <typename _container_t>
+struct share_forward : public testing::Test
+{
+    using container_t = _container_t;
+
+    static container_t make() { return container_t{1, 2, 3, 4, 5, 6}; }
+};
+
+using container_types = ::testing::Types<std::forward_list<int>, std::list<int>, std::deque<int>, std::vector<int>>;
+
+TYPED_TEST_SUITE(share_forward, container_types);
+
+TYPED_TEST(share_forward, type_checks)
+{
+    using container_t = typename TestFixture::container_t;
+    using shared_t    = decltype(TestFixture::make() | radr::share);
+
+    EXPECT_TRUE(std::ranges::view<shared_t>);
+    EXPECT_FALSE(std::ranges::borrowed_range<shared_t>);
+    EXPECT_TRUE(radr::const_symmetric_range<shared_t>);
+    EXPECT_FALSE(radr::mutable_range<shared_t>);
+    EXPECT_SAME_TYPE(std::ranges::range_reference_t<shared_t>, int const &);
+
+    EXPECT_EQ(std::ranges::sized_range<shared_t>, std::ranges::sized_range<container_t>);
+    EXPECT_EQ(std::ranges::bidirectional_range<shared_t>, std::ranges::bidirectional_range<container_t>);
+    EXPECT_EQ(std::ranges::random_access_range<shared_t>, std::ranges::random_access_range<container_t>);
+    EXPECT_EQ(std::ranges::contiguous_range<shared_t>, std::ranges::contiguous_range<container_t>);
+}
+
+TYPED_TEST(share_forward, copy_is_shallow)
+{
+    auto s = TestFixture::make() | radr::share;
+    EXPECT_RANGE_EQ(s, comp);
+    EXPECT_EQ(s.use_count(), 1);
+
+    auto s2 = s;
+    EXPECT_RANGE_EQ(s2, comp);
+    EXPECT_EQ(s.use_count(), 2);
+    EXPECT_EQ(std::addressof(*s.begin()), std::addressof(*s2.begin()));
+
+    decltype(s) s3;
+    EXPECT_TRUE(std::ranges::empty(s3));
+    s3 = s2;
+    EXPECT_EQ(s.use_count(), 3);
+    EXPECT_EQ(std::addressof(*s.begin()), std::addressof(*s3.begin()));
+
+    // re-sharing is a NOOP
+    auto s4 = s3 | radr::share;
+    EXPECT_SAME_TYPE(decltype(s4), decltype(s));
+    EXPECT_EQ(s.use_count(), 4);
+}
+
+TYPED_TEST(share_forward, adaptors)
+{
+    auto s = TestFixture::make() | radr::share;
+
+    // lvalues of shared_rad can be adapted
+    auto t = s | radr::filter(is_odd) | radr::take(2);
+    EXPECT_TRUE(radr::detail::is_shared_rad<decltype(t)>);
+    EXPECT_RANGE_EQ(t, (std::vector{1, 3}));
+    EXPECT_EQ(s.use_count(), 2);
+
+    auto t2 = t;
+    EXPECT_RANGE_EQ(t2, (std::vector{1, 3}));
+    EXPECT_EQ(std::addressof(*t.begin()), std::addressof(*s.begin()));
+    EXPECT_EQ(s.use_count(), 3);
+
+    auto u = std::move(s) | radr::transform([](int i) { return i * 2; });
+    EXPECT_RANGE_EQ(u, (std::vector{2, 4, 6, 8, 10, 12}));
+    EXPECT_EQ(u.use_count(), 3);
+}
+
+TYPED_TEST(share_forward, lifetime)
+{
+    using t_t = decltype(TestFixture::make() | radr::share | radr::take(3));
+    t_t t;
+
+    {
+        auto s = TestFixture::make() | radr::share;
+        t      = s | radr::take(3);
+    }
+
+    EXPECT_EQ(t.use_count(), 1);
+    EXPECT_RANGE_EQ(t, (std::vector{1, 2, 3}));
+}
+
+TEST(share, allocator)
+{
+    std::pmr::monotonic_buffer_resource res;
+    std::pmr::polymorphic_allocator<>   alloc{&res};
+
+    auto s = radr::shared_rad{std::allocator_arg, alloc, std::list{1, 2, 3}} | radr::take(2);
+    EXPECT_RANGE_EQ(s, (std::vector{1, 2}));
+}
+
+TEST(share, string)
+{
+    auto s = std::string{"foobar"} | radr::share;
+    auto t = s | radr::take(3);
+    EXPECT_RANGE_EQ(t, std::string_view{"foo"});
+    EXPECT_EQ(t.use_count(), 2);
+}
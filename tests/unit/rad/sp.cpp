@@ -0,0 +1,140 @@
+#include <memory>
+#include <ranges>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <radr/test/aux_ranges.hpp>
+#include <radr/test/gtest_helpers.hpp>
+
+#include <radr/factory/istream.hpp>
+#include <radr/rad/sp.hpp>
+#include <radr/rad/to_single_pass.hpp>
+
+// --------------------------------------------------------------------------
+// type checks
+// --------------------------------------------------------------------------
+
+TEST(sp, type_checks)
+{
+    auto ra = radr::test::iota_input_range(1, 7) | radr::sp::take(3);
+    using ra_t = decltype(ra);
+
+    EXPECT_TRUE(std::ranges::input_range<ra_t>);
+    EXPECT_TRUE(std::ranges::view<ra_t>);
+    EXPECT_FALSE(std::ranges::forward_range<ra_t>);
+    EXPECT_FALSE(std::copyable<ra_t>);
+    EXPECT_FALSE(std::copyable<std::ranges::iterator_t<ra_t>>);
+    EXPECT_SAME_TYPE(std::ranges::range_value_t<ra_t>, size_t);
+
+    // forward ranges are demoted
+    auto ra2 = std::vector{1, 2, 3} | radr::sp::take(2);
+    EXPECT_TRUE(std::ranges::input_range<decltype(ra2)>);
+    EXPECT_FALSE(std::ranges::forward_range<decltype(ra2)>);
+    EXPECT_SAME_TYPE(std::ranges::range_reference_t<decltype(ra2)>, int &);
+}
+
+// --------------------------------------------------------------------------
+// individual adaptors
+// --------------------------------------------------------------------------
+
+inline constexpr auto is_odd = [](size_t i)
+{
+    return i % 2 == 1;
+};
+
+inline constexpr auto smaller_5 = [](size_t i)
+{
+    return i < 5;
+};
+
+TEST(sp, take)
+{
+    EXPECT_RANGE_EQ(radr::test::iota_input_range(1, 7) | radr::sp::take(3), (std::vector<size_t>{1, 2, 3}));
+    EXPECT_RANGE_EQ(radr::test::iota_input_range(1, 3) | radr::sp::take(3), (std::vector<size_t>{1, 2}));
+    EXPECT_RANGE_EQ(radr::test::iota_input_range(1, 7) | radr::sp::take(0), (std::vector<size_t>{}));
+}
+
+TEST(sp, take_does_not_overread)
+{
+    std::istringstream stream{"1 2 3 4"};
+    std::vector<int>   out;
+    std::ranges::copy(radr::istream<int>(stream) | radr::sp::take(2), std::back_inserter(out));
+    EXPECT_RANGE_EQ(out, (std::vector{1, 2}));
+
+    // the third number has not been extracted
+    int i = 0;
+    stream >> i;
+    EXPECT_EQ(i, 3);
+}
+
+TEST(sp, drop)
+{
+    EXPECT_RANGE_EQ(radr::test::iota_input_range(1, 7) | radr::sp::drop(3), (std::vector<size_t>{4, 5, 6}));
+    EXPECT_RANGE_EQ(radr::test::iota_input_range(1, 3) | radr::sp::drop(3), (std::vector<size_t>{}));
+}
+
+TEST(sp, transform)
+{
+    auto ra = radr::test::iota_input_range(1, 4) | radr::sp::transform([](size_t i) { return std::to_string(i); });
+    EXPECT_SAME_TYPE(std::ranges::range_reference_t<decltype(ra)>, std::string);
+    EXPECT_SAME_TYPE(std::ranges::range_value_t<decltype(ra)>, std::string);
+    EXPECT_RANGE_EQ(ra, (std::vector<std::string>{"1", "2", "3"}));
+}
+
+TEST(sp, filter)
+{
+    EXPECT_RANGE_EQ(radr::test::iota_input_range(1, 7) | radr::sp::filter(is_odd), (std::vector<size_t>{1, 3, 5}));
+    EXPECT_RANGE_EQ(radr::test::iota_input_range(2, 3) | radr::sp::filter(is_odd), (std::vector<size_t>{}));
+}
+
+TEST(sp, take_while)
+{
+    EXPECT_RANGE_EQ(radr::test::iota_input_range(1, 9) | radr::sp::take_while(smaller_5),
+                    (std::vector<size_t>{1, 2, 3, 4}));
+    EXPECT_RANGE_EQ(radr::test::iota_input_range(7, 9) | radr::sp::take_while(smaller_5), (std::vector<size_t>{}));
+}
+
+TEST(sp, drop_while)
+{
+    EXPECT_RANGE_EQ(radr::test::iota_input_range(1, 7) | radr::sp::drop_while(smaller_5), (std::vector<size_t>{5, 6}));
+    EXPECT_RANGE_EQ(radr::test::iota_input_range(1, 3) | radr::sp::drop_while(smaller_5), (std::vector<size_t>{}));
+}
+
+TEST(sp, as_rvalue)
+{
+    std::vector<std::unique_ptr<int>> vec;
+    vec.push_back(std::make_unique<int>(1));
+    vec.push_back(std::make_unique<int>(2));
+
+    auto ra = std::move(vec) | radr::to_single_pass | radr::sp::as_rvalue;
+    EXPECT_SAME_TYPE(std::ranges::range_reference_t<decltype(ra)>, std::unique_ptr<int> &&);
+
+    std::vector<std::unique_ptr<int>> out;
+    for (auto && p : ra)
+        out.push_back(std::move(p));
+
+    ASSERT_EQ(out.size(), 2u);
+    EXPECT_EQ(*out[0], 1);
+    EXPECT_EQ(*out[1], 2);
+}
+
+// --------------------------------------------------------------------------
+// combinations
+// --------------------------------------------------------------------------
+
+TEST(sp, chain)
+{
+    auto ra = radr::test::iota_input_range(1, 100) | radr::sp::drop(2) | radr::sp::filter(is_odd) |
+              radr::sp::transform([](size_t i) { return i * 10; }) | radr::sp::take(3);
+
+    EXPECT_RANGE_EQ(ra, (std::vector<size_t>{30, 50, 70}));
+}
+
+TEST(sp, move_before_begin)
+{
+    auto ra  = radr::test::iota_input_range(1, 7) | radr::sp::filter(is_odd);
+    auto ra2 = std::move(ra);
+    EXPECT_RANGE_EQ(ra2, (std::vector<size_t>{1, 3, 5}));
+}
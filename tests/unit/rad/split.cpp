@@ -1,5 +1,9 @@
+#include <cstdint>
 #include <forward_list>
 #include <ranges>
+#include <span>
+#include <string>
+#include <vector>
 
 #include <gtest/gtest.h>
 #include <radr/test/adaptor_template.hpp>
@@ -30,7 +34,8 @@ TEST(split, single_pass)
     ++it;
     EXPECT_EQ(it, ra.end());
 
-    EXPECT_SAME_TYPE(decltype(*it), (radr::generator<char &, char> &));
+    EXPECT_TRUE(std::ranges::input_range<decltype(*it)>);
+    EXPECT_SAME_TYPE(std::ranges::range_reference_t<decltype(*it)>, char &);
 }
 
 TEST(split, single_pass_empty)
@@ -50,7 +55,8 @@ TEST(split, single_pass_empty)
     ++it;
     EXPECT_EQ(it, ra.end());
 
-    EXPECT_SAME_TYPE(decltype(*it), (radr::generator<char &, char> &));
+    EXPECT_TRUE(std::ranges::input_range<decltype(*it)>);
+    EXPECT_SAME_TYPE(std::ranges::range_reference_t<decltype(*it)>, char &);
 }
 
 TEST(split, single_pass_trailing_empty)
@@ -70,7 +76,24 @@ TEST(split, single_pass_trailing_empty)
     ++it;
     EXPECT_EQ(it, ra.end());
 
-    EXPECT_SAME_TYPE(decltype(*it), (radr::generator<char &, char> &));
+    EXPECT_TRUE(std::ranges::input_range<decltype(*it)>);
+    EXPECT_SAME_TYPE(std::ranges::range_reference_t<decltype(*it)>, char &);
+}
+
+TEST(split, single_pass_skip_unconsumed)
+{
+    auto ra = std::string("thisXisXaXtest") | radr::to_single_pass | radr::split('X');
+
+    auto it = ra.begin();
+    auto b  = std::ranges::begin(*it);
+    EXPECT_EQ(*b, 't');
+    ++it; // rest of "this" is skipped
+    ++it; // "is" is skipped without being looked at
+    EXPECT_RANGE_EQ(*it, "a"sv);
+    ++it;
+    EXPECT_RANGE_EQ(*it, "test"sv);
+    ++it;
+    EXPECT_EQ(it, ra.end());
 }
 
 // --------------------------------------------------------------------------
@@ -342,3 +365,102 @@ TEST(split, owning_copy_test)
     auto cpy = own;
     EXPECT_RANGE_EQ(own, cpy);
 }
+
+// --------------------------------------------------------------------------
+// contiguous ranges of integers (memchr / SIMD search)
+// --------------------------------------------------------------------------
+
+template <typename T>
+void contiguous_elem_impl()
+{
+    /* delimiters around the boundaries of 16 and 32 byte blocks */
+    std::vector<T> v(200, T{1});
+    for (size_t i : {0u, 1u, 7u, 8u, 15u, 16u, 17u, 31u, 32u, 33u, 63u, 64u, 150u, 199u})
+        v[i] = T{7};
+
+    auto comp = v | std::views::split(T{7});
+
+    EXPECT_TRUE((radr::detail::split_simd_findable<T *, T *, std::span<T const, 1>>));
+    EXPECT_TRUE(std::ranges::equal(std::ref(v) | radr::split(T{7}), comp, std::ranges::equal));
+
+    T const delim = 7;
+    EXPECT_TRUE(std::ranges::equal(std::ref(v) | radr::split(std::ref(delim)), comp, std::ranges::equal));
+
+    std::vector<T> const pattern{7};
+    EXPECT_TRUE(std::ranges::equal(std::ref(v) | radr::split(std::ref(pattern)), comp, std::ranges::equal));
+
+    /* no delimiter */
+    std::vector<T> w(100, T{1});
+    auto           ra = std::ref(w) | radr::split(T{7});
+    EXPECT_EQ(std::ranges::distance(ra), 1);
+    EXPECT_RANGE_EQ(*ra.begin(), w);
+}
+
+TEST(split, contiguous_elem)
+{
+    contiguous_elem_impl<char>();
+    contiguous_elem_impl<uint8_t>();
+    contiguous_elem_impl<int16_t>();
+    contiguous_elem_impl<uint32_t>();
+    contiguous_elem_impl<int64_t>();
+}
+
+TEST(split, contiguous_elem_trailing)
+{
+    std::string s  = "aXbXXcX";
+    auto        ra = std::ref(s) | radr::split('X');
+    std::vector<std::string_view> parts;
+    for (auto && part : ra)
+        parts.emplace_back(part.begin(), part.end());
+    EXPECT_RANGE_EQ(parts, (std::vector<std::string_view>{"a", "b", "", "c", ""}));
+}
+
+template <typename T>
+void contiguous_pattern_impl(size_t const pattern_size)
+{
+    std::vector<T> pattern(pattern_size);
+    for (size_t i = 0; i < pattern_size; ++i)
+        pattern[i] = static_cast<T>(i % 3 + 1); // 1 2 3 1 2 ...
+
+    /* text of 1s with partial matches (first and last element equal) and real matches at block boundaries */
+    std::vector<T> v(300, T{1});
+    for (size_t i = 40; i + pattern_size < 120; i += pattern_size + 1)
+    {
+        std::ranges::copy(pattern, v.begin() + i);
+        v[i + pattern_size / 2] = T{9};
+    }
+    for (size_t i : {0u, 15u, 16u, 31u, 33u, 130u, 160u, 191u})
+        std::ranges::copy(pattern, v.begin() + i);
+    std::ranges::copy(pattern, v.end() - pattern_size);
+
+    auto comp = v | std::views::split(pattern);
+
+    EXPECT_TRUE(std::ranges::equal(std::ref(v) | radr::split(std::ref(pattern)), comp, std::ranges::equal));
+    EXPECT_TRUE(std::ranges::equal(std::ref(v) | radr::split(std::span<T const>{pattern}), comp, std::ranges::equal));
+
+    /* pattern longer than the text */
+    std::vector<T> w(pattern.begin(), pattern.end() - 1);
+    EXPECT_EQ(std::ranges::distance(std::ref(w) | radr::split(std::ref(pattern))), 1);
+}
+
+TEST(split, contiguous_pattern)
+{
+    for (size_t pattern_size : {2u, 3u, 4u, 7u, 16u})
+    {
+        contiguous_pattern_impl<char>(pattern_size);
+        contiguous_pattern_impl<uint8_t>(pattern_size);
+        contiguous_pattern_impl<uint16_t>(pattern_size);
+        contiguous_pattern_impl<int32_t>(pattern_size);
+        contiguous_pattern_impl<uint64_t>(pattern_size);
+    }
+
+    /* overlapping prefixes */
+    std::string_view s = "aaabaabaaab";
+    EXPECT_TRUE(std::ranges::equal(s | radr::split("aab"sv), s | std::views::split("aab"sv), std::ranges::equal));
+
+    std::string const text = "foo\r\nbar\r\n\r\nbax\r";
+    std::vector<std::string_view> parts;
+    for (auto && part : std::ref(text) | radr::split("\r\n"sv))
+        parts.emplace_back(part.begin(), part.end());
+    EXPECT_RANGE_EQ(parts, (std::vector<std::string_view>{"foo", "bar", "", "bax\r"}));
+}
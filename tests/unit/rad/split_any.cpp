@@ -0,0 +1,149 @@
+#include <cstdint>
+#include <forward_list>
+#include <list>
+#include <ranges>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <radr/test/gtest_helpers.hpp>
+
+#include <radr/rad/split_any.hpp>
+
+using namespace std::string_view_literals;
+
+std::vector<std::string> to_strings(auto && rng)
+{
+    std::vector<std::string> ret;
+    for (auto && part : rng)
+        ret.emplace_back(part.begin(), part.end());
+    return ret;
+}
+
+TEST(split_any, string_view)
+{
+    auto ra = "foo bar,bax;;x\ty"sv | radr::split_any(" \t,;"sv);
+    EXPECT_EQ(to_strings(ra), (std::vector<std::string>{"foo", "bar", "bax", "", "x", "y"}));
+    EXPECT_SAME_TYPE(std::ranges::range_reference_t<decltype(ra)>, std::string_view);
+    EXPECT_TRUE(std::ranges::borrowed_range<decltype(ra)>);
+}
+
+TEST(split_any, leading_trailing)
+{
+    EXPECT_EQ(to_strings(",a,"sv | radr::split_any(",;"sv)), (std::vector<std::string>{"", "a", ""}));
+    EXPECT_EQ(to_strings(";"sv | radr::split_any(",;"sv)), (std::vector<std::string>{"", ""}));
+    EXPECT_EQ(to_strings("abc"sv | radr::split_any(",;"sv)), (std::vector<std::string>{"abc"}));
+    EXPECT_EQ(to_strings("abc"sv | radr::split_any(""sv)), (std::vector<std::string>{"abc"}));
+    EXPECT_TRUE(std::ranges::empty(""sv | radr::split_any(",;"sv)));
+}
+
+TEST(split_any, lvalue_delims)
+{
+    std::string       s      = "a b\nc";
+    std::string const delims = " \n";
+    auto              ra     = std::ref(s) | radr::split_any(std::ref(delims));
+    EXPECT_EQ(to_strings(ra), (std::vector<std::string>{"a", "b", "c"}));
+    EXPECT_SAME_TYPE(std::ranges::range_reference_t<decltype(ra)>, radr::borrowing_rad<char *>);
+
+    /* owning */
+    auto own = std::string{"a b\nc"} | radr::split_any(std::ref(delims));
+    auto cpy = own;
+    EXPECT_EQ(to_strings(cpy), (std::vector<std::string>{"a", "b", "c"}));
+}
+
+TEST(split_any, non_ascii)
+{
+    std::string const delims = "\xff\x80 ";
+    std::string const s      = "a\xff"
+                          "b\x80"
+                          "c d\x7f"
+                          "e";
+    EXPECT_EQ(to_strings(std::ref(s) | radr::split_any(std::ref(delims))),
+              (std::vector<std::string>{"a", "b", "c", "d\x7f"
+                                                       "e"}));
+}
+
+TEST(split_any, mixed_signedness)
+{
+    /* elements are compared by value: char(-1) is not equal to (unsigned char)255 if char is signed */
+    std::string const                s = "a\xff"
+                                         "b c";
+    std::vector<unsigned char> const delims{0xff, ' '};
+
+    std::vector<std::string> const comp = std::is_signed_v<char> ? std::vector<std::string>{"a\xff"
+                                                                                            "b",
+                                                                                            "c"}
+                                                                 : std::vector<std::string>{"a", "b", "c"};
+    EXPECT_EQ(to_strings(std::ref(s) | radr::split_any(std::ref(delims))), comp);
+}
+
+void long_input_impl(std::string const & delims)
+{
+    /* every byte value, and delimiters around the boundaries of 16 and 32 byte blocks */
+    std::string s;
+    for (size_t i = 0; i < 1000; ++i)
+        s.push_back(static_cast<char>(i % 256));
+
+    std::vector<std::string> comp;
+    std::string              cur;
+    for (char c : s)
+    {
+        if (delims.find(c) != std::string::npos)
+            comp.push_back(std::exchange(cur, {}));
+        else
+            cur.push_back(c);
+    }
+    comp.push_back(cur);
+
+    EXPECT_EQ(to_strings(std::ref(s) | radr::split_any(std::ref(delims))), comp);
+    EXPECT_EQ(to_strings(std::ref(s) | radr::split_any(std::string_view{delims})), comp);
+}
+
+TEST(split_any, long_input)
+{
+    long_input_impl("\t ,;\x80\xfe");
+    long_input_impl("\t ,;\x80\xfe\t\t"); // duplicates
+    long_input_impl("\t ,;:.!?\x80\xfe()");  // more than eight
+}
+
+TEST(split_any, non_contiguous)
+{
+    std::list<char> l{'a', ' ', 'b', ',', 'c'};
+    EXPECT_EQ(to_strings(std::ref(l) | radr::split_any(" ,"sv)), (std::vector<std::string>{"a", "b", "c"}));
+
+    std::forward_list<char> fl{'a', ' ', 'b', ',', 'c'};
+    EXPECT_EQ(to_strings(std::ref(fl) | radr::split_any(" ,"sv)), (std::vector<std::string>{"a", "b", "c"}));
+}
+
+TEST(split_any, non_bytes)
+{
+    std::vector<int> v{1, 0, 2, 3, -1, 4};
+    std::vector<int> delims{0, -1};
+    auto             ra = std::ref(v) | radr::split_any(std::ref(delims));
+
+    std::vector<std::vector<int>> parts;
+    for (auto && part : ra)
+        parts.emplace_back(part.begin(), part.end());
+    EXPECT_EQ(parts, (std::vector<std::vector<int>>{{1}, {2, 3}, {4}}));
+}
+
+TEST(split_any, concepts)
+{
+    std::string s  = "a b";
+    auto        ra = std::ref(s) | radr::split_any(" "sv);
+    using ra_t     = decltype(ra);
+    EXPECT_TRUE(std::ranges::forward_range<ra_t>);
+    EXPECT_TRUE(std::ranges::forward_range<ra_t const>);
+    EXPECT_FALSE(std::ranges::bidirectional_range<ra_t>);
+    EXPECT_FALSE(std::ranges::sized_range<ra_t>);
+    EXPECT_FALSE(std::ranges::common_range<ra_t>);
+    EXPECT_SAME_TYPE(std::ranges::range_reference_t<ra_t const>, std::string_view);
+}
+
+TEST(split_any, constexpr_)
+{
+    constexpr size_t n = std::ranges::distance("a b,c"sv | radr::split_any(" ,"sv));
+    EXPECT_EQ(n, 3u);
+}
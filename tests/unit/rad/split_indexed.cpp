@@ -0,0 +1,137 @@
+#include <cstdint>
+#include <deque>
+#include <ranges>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <radr/test/gtest_helpers.hpp>
+
+#include <radr/algorithm/par.hpp>
+#include <radr/rad/slice.hpp>
+#include <radr/rad/split.hpp>
+#include <radr/rad/split_indexed.hpp>
+
+using namespace std::string_view_literals;
+
+std::vector<std::string> to_strings(auto && rng)
+{
+    std::vector<std::string> ret;
+    for (auto && part : rng)
+        ret.emplace_back(part.begin(), part.end());
+    return ret;
+}
+
+TEST(split_indexed, concepts)
+{
+    std::string s  = "foo\nbar";
+    auto        ra = std::ref(s) | radr::split_indexed('\n');
+    using ra_t     = decltype(ra);
+
+    EXPECT_TRUE(std::ranges::random_access_range<ra_t>);
+    EXPECT_TRUE(std::ranges::random_access_range<ra_t const>);
+    EXPECT_TRUE(std::ranges::sized_range<ra_t>);
+    EXPECT_TRUE(std::ranges::common_range<ra_t>);
+    EXPECT_FALSE(std::ranges::borrowed_range<ra_t>);
+    EXPECT_SAME_TYPE(std::ranges::range_reference_t<ra_t>, radr::borrowing_rad<char *>);
+    EXPECT_SAME_TYPE(std::ranges::range_value_t<ra_t const>, std::string_view);
+
+    auto sv = "foo\nbar"sv | radr::split_indexed('\n');
+    EXPECT_SAME_TYPE(std::ranges::range_reference_t<decltype(sv)>, std::string_view);
+}
+
+TEST(split_indexed, elements)
+{
+    std::string_view log   = "foo\nbar\n\nbax\n";
+    auto             lines = log | radr::split_indexed('\n');
+
+    EXPECT_EQ(lines.size(), 5u);
+    EXPECT_EQ(lines[0], "foo"sv);
+    EXPECT_EQ(lines[1], "bar"sv);
+    EXPECT_EQ(lines[2], ""sv);
+    EXPECT_EQ(lines[3], "bax"sv);
+    EXPECT_EQ(lines[4], ""sv);
+
+    auto it = lines.end();
+    EXPECT_EQ(*(it - 2), "bax"sv);
+    EXPECT_EQ(lines.end() - lines.begin(), 5);
+    EXPECT_EQ(to_strings(std::ref(lines) | radr::slice(1, 4)), (std::vector<std::string>{"bar", "", "bax"}));
+}
+
+TEST(split_indexed, same_as_split)
+{
+    std::vector<std::string_view> inputs{""sv, "a"sv, "\r\n"sv, "a\r\nb"sv, "\r\n\r\na\r\r\nb\r\n"sv, "aaaa"sv};
+    for (std::string_view in : inputs)
+    {
+        EXPECT_EQ(to_strings(in | radr::split_indexed("\r\n"sv)), to_strings(in | radr::split("\r\n"sv)));
+        EXPECT_EQ(to_strings(in | radr::split_indexed('a')), to_strings(in | radr::split('a')));
+        EXPECT_EQ(to_strings(in | radr::split_indexed("aa"sv)), to_strings(in | radr::split("aa"sv)));
+        EXPECT_EQ(to_strings(in | radr::split_indexed(""sv)), to_strings(in | radr::split(""sv)));
+    }
+}
+
+TEST(split_indexed, patterns)
+{
+    std::string       s     = "a, b, c";
+    std::string const delim = ", ";
+    char const        c     = ',';
+
+    EXPECT_EQ(to_strings(std::ref(s) | radr::split_indexed(std::ref(delim))),
+              (std::vector<std::string>{"a", "b", "c"}));
+    EXPECT_EQ(to_strings(std::ref(s) | radr::split_indexed(std::ref(c))), (std::vector<std::string>{"a", " b", " c"}));
+    EXPECT_EQ(to_strings(radr::split_indexed(std::ref(s), ", "sv)), (std::vector<std::string>{"a", "b", "c"}));
+
+    std::deque<int> d{1, 0, 2, 3, 0};
+    auto            ra = std::ref(d) | radr::split_indexed(0);
+    EXPECT_EQ(ra.size(), 3u);
+    EXPECT_RANGE_EQ(ra[1], (std::vector<int>{2, 3}));
+    EXPECT_TRUE(std::ranges::empty(ra[2]));
+}
+
+TEST(split_indexed, owning)
+{
+    auto ra = std::string{"foo\nbar"} | radr::split_indexed('\n');
+    EXPECT_EQ(to_strings(ra), (std::vector<std::string>{"foo", "bar"}));
+
+    auto cpy = ra;
+    EXPECT_EQ(to_strings(cpy), (std::vector<std::string>{"foo", "bar"}));
+    EXPECT_RANGE_EQ(cpy[1], "bar"sv);
+
+    auto mv = std::move(cpy);
+    EXPECT_RANGE_EQ(mv[0], "foo"sv);
+}
+
+TEST(split_indexed, parallel)
+{
+    /* periodic text with overlapping candidates ("aaa") across the boundaries of parts */
+    std::string text;
+    for (size_t i = 0; text.size() < 600'000; ++i)
+        text += i % 7 == 0 ? "aaaaaaa|" : "line " + std::to_string(i) + "aa|";
+
+    for (std::string_view pat : {"|"sv, "aa"sv, "aaa"sv, "a|l"sv})
+    {
+        auto seq = radr::split_indexed(std::ref(text), pat);
+        EXPECT_EQ(to_strings(seq), to_strings(std::ref(text) | radr::split(pat)));
+
+        for (size_t threads : {2u, 3u, 8u})
+        {
+            auto par = radr::split_indexed(std::ref(text), pat, threads);
+            EXPECT_EQ(par.size(), seq.size());
+            EXPECT_TRUE(std::ranges::equal(par, seq, std::ranges::equal));
+        }
+    }
+}
+
+TEST(split_indexed, par_for_each)
+{
+    std::string text;
+    for (size_t i = 0; i < 10'000; ++i)
+        text += "line\n";
+
+    auto                lines = radr::split_indexed(std::ref(text), '\n', 0);
+    std::atomic<size_t> count{0};
+    radr::par::for_each(lines, [&count](auto const & l) { count += l.size(); }, 4);
+    EXPECT_EQ(count.load(), 40'000u);
+}